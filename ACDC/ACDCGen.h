@@ -14,6 +14,7 @@
 #include "ACDCTraits.h"
 #include "ACDCGenCell.h"
 #include "ThePEG/Utilities/Exception.h"
+#include "ThePEG/Utilities/AliasTable.h"
 
 namespace ACDCGenerator {
 
@@ -397,6 +398,12 @@ private:
    */
   inline ACDCGenCell * lastCell() const;
 
+  /**
+   * Rebuild the table used to select functions from the current
+   * overestimated integrals.
+   */
+  inline void buildFunctionTable();
+
 
   /**
    * Choose a function according to its overestimated integral and
@@ -492,6 +499,18 @@ private:
    */
   DVector theSumMaxInts;
 
+  /**
+   * The table used to select a function according to its
+   * overestimated integral in constant time. Rebuilt from
+   * theSumMaxInts when these have changed.
+   */
+  ThePEG::AliasTable<size_type> theFunctionTable;
+
+  /**
+   * False if theFunctionTable needs to be rebuilt.
+   */
+  bool theFunctionTableValid;
+
   /**
    * The last index chosen
    */
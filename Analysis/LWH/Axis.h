@@ -127,6 +127,20 @@ public:
     else return int((coord - lower)/binWidth(0));
   }
 
+  /**
+   * Convert \a n coordinates in \a coord to bin numbers in \a index
+   * in the same way as coordToIndex(double). The bin width is only
+   * calculated once.
+   */
+  void coordToIndex(const double * coord, int * index, int n) const {
+    const double width = binWidth(0);
+    for ( int i = 0; i < n; ++i ) {
+      const double c = coord[i];
+      index[i] = c >= upper? int(OVERFLOW_BIN):
+	( c < lower? int(UNDERFLOW_BIN): int((c - lower)/width) );
+    }
+  }
+
   /**
    * Return the midpoint of the specified bin. No checking is
    * performed to ensure the argument is a valid bin.
@@ -100,6 +100,7 @@ public:
    */
   void clear() {
     dset.clear();
+    for ( int s = 0, S = shards.size(); s < S; ++s ) shards[s].clear();
   }
 
   /**
@@ -183,8 +184,9 @@ public:
    * @return The newly added point.
    */
   IDataPoint * addPoint() {
-    dset.push_back(DataPoint(dimension()));
-    return &(dset.back());
+    std::vector<DataPoint> & set = fillSet();
+    set.push_back(DataPoint(dimension()));
+    return &(set.back());
   }
 
   /**
@@ -195,10 +197,42 @@ public:
    */
   bool addPoint(const IDataPoint & point) {
     if ( dimension() && dimension() != point.dimension() ) return false;
-    dset.push_back(DataPoint(point));
+    fillSet().push_back(DataPoint(point));
     return true;
   }
 
+  /**
+   * Append the points of all the sets in \a sets to this one in the
+   * order given.
+   * @return false if the dimensions do not match.
+   */
+  bool add(const std::vector<const DataPointSet *> & sets) {
+    for ( int i = 0, N = sets.size(); i < N; ++i )
+      if ( sets[i]->dimension() != dimension() ) return false;
+    for ( int i = 0, N = sets.size(); i < N; ++i )
+      dset.insert(dset.end(), sets[i]->dset.begin(), sets[i]->dset.end());
+    return true;
+  }
+
+  /**
+   * Prepare the set to be filled from \a n shards.
+   */
+  void setShards(int n) {
+    mergeShards();
+    shards.resize(std::max(n - 1, 0));
+  }
+
+  /**
+   * Append the points added in shards 1 and up to this set, in the
+   * order of the shards, and clear the shards.
+   */
+  void mergeShards() {
+    for ( int s = 0, S = shards.size(); s < S; ++s ) {
+      dset.insert(dset.end(), shards[s].begin(), shards[s].end());
+      shards[s].clear();
+    }
+  }
+
   /**
    * Remove the IDataPoint at a given index.
    * @param index The index of the IDataPoint to be removed.
@@ -347,6 +381,57 @@ public:
     return true;
   }
 
+  /**
+   * Write out the data point set in the compact binary format.
+   */
+  bool writeBinary(std::ostream & os, std::string path, std::string name) {
+    binaryOut(os, int(dataPointSetTag));
+    binaryOut(os, path);
+    binaryOut(os, name);
+    binaryOut(os, title());
+    binaryOut(os, dimension());
+    binaryOut(os, size());
+    for ( int i = 0, N = size(); i < N; ++i )
+      for ( int j = 0, M = dimension(); j < M; ++j ) {
+	const IMeasurement * m = point(i)->coordinate(j);
+	binaryOut(os, m->value());
+	binaryOut(os, m->errorPlus());
+	binaryOut(os, m->errorMinus());
+      }
+    return os.good();
+  }
+
+  /**
+   * Read a data point set written by writeBinary() from the stream \a
+   * is, where the type tag, path and name have already been read.
+   * @return the new data point set or null if the read failed.
+   */
+  static DataPointSet * readBinary(std::istream & is) {
+    std::string title;
+    int d = 0;
+    int n = 0;
+    if ( !binaryIn(is, title) || !binaryIn(is, d) || !binaryIn(is, n) ||
+	 d < 0 || n < 0 ) return 0;
+    DataPointSet * dps = new DataPointSet(d);
+    dps->setTitle(title);
+    for ( int i = 0; i < n; ++i ) {
+      IDataPoint * p = dps->addPoint();
+      for ( int j = 0; j < d; ++j ) {
+	double v = 0.0;
+	double ep = 0.0;
+	double em = 0.0;
+	if ( !binaryIn(is, v) || !binaryIn(is, ep) || !binaryIn(is, em) ) {
+	  delete dps;
+	  return 0;
+	}
+	p->coordinate(j)->setValue(v);
+	p->coordinate(j)->setErrorPlus(ep);
+	p->coordinate(j)->setErrorMinus(em);
+      }
+    }
+    return dps;
+  }
+
 private:
 
   /** The title */
@@ -357,6 +442,24 @@ private:
    */
   std::vector<DataPoint> dset;
 
+  /**
+   * The points added in shards 1 and up, if the set is filled from
+   * several threads.
+   */
+  std::vector< std::vector<DataPoint> > shards;
+
+  /**
+   * Return the points to be filled by the current thread.
+   */
+  std::vector<DataPoint> & fillSet() {
+    int s = currentShard();
+    if ( s == 0 ) return dset;
+    if ( s < 0 || s > int(shards.size()) )
+      throw std::runtime_error("LWH::DataPointSet: filled from a shard "
+			       "which has not been set up");
+    return shards[s - 1];
+  }
+
   /**
    * The dimension of the points in this set.
    */
@@ -33,14 +33,16 @@ public:
   /** HistFactory is a friend. */
   friend class HistogramFactory;
 
+  /** Tree is a friend. */
+  friend class Tree;
+
 public:
 
   /**
    * Standard constructor.
    */
   Histogram1D(int n, double lo, double up)
-    : fax(new Axis(n, lo, up)), vax(0),
-      sum(n + 2), sumw(n + 2), sumw2(n + 2), sumxw(n + 2), sumx2w(n + 2) {
+    : fax(new Axis(n, lo, up)), vax(0), bin(n + 2), normalized(false) {
     ax = fax;
   }
 
@@ -48,9 +50,8 @@ public:
    * Standard constructor for variable bin width.
    */
   Histogram1D(const std::vector<double> & edges)
-    : fax(0), vax(new VariAxis(edges)),
-      sum(edges.size() + 1), sumw(edges.size() + 1), sumw2(edges.size() + 1),
-      sumxw(edges.size() + 1), sumx2w(edges.size() + 1) {
+    : fax(0), vax(new VariAxis(edges)), bin(edges.size() + 1),
+      normalized(false) {
     ax = vax;
   }
 
@@ -59,10 +60,10 @@ public:
    */
   Histogram1D(const Histogram1D & h)
     : IBaseHistogram(h), IHistogram(h), IHistogram1D(h), ManagedObject(h),
-      fax(0), vax(0), sum(h.sum), sumw(h.sumw), sumw2(h.sumw2),
-      sumxw(h.sumxw), sumx2w(h.sumx2w) {
+      fax(0), vax(0), bin(h.bin), shards(h.shards),
+      normalized(h.normalized) {
     const VariAxis * hvax = dynamic_cast<const VariAxis *>(h.ax);
-    if ( vax ) ax = vax = new VariAxis(*hvax);
+    if ( hvax ) ax = vax = new VariAxis(*hvax);
     else ax = fax = new Axis(dynamic_cast<const Axis &>(*h.ax));
 }
 
@@ -124,11 +125,9 @@ public:
    * @return false If something goes wrong.
    */
   bool reset() {
-    sum = std::vector<int>(ax->bins() + 2);
-    sumw = std::vector<double>(ax->bins() + 2);
-    sumxw = std::vector<double>(ax->bins() + 2);
-    sumx2w = std::vector<double>(ax->bins() + 2);
-    sumw2 = std::vector<double>(ax->bins() + 2);
+    bin = std::vector<BinData>(ax->bins() + 2);
+    for ( int s = 0, S = shards.size(); s < S; ++s ) shards[s].clear();
+    normalized = false;
     return true;
   }
 
@@ -138,8 +137,9 @@ public:
    *
    */ 
   int entries() const {
+    syncShards();
     int si = 0;
-    for ( int i = 2; i < ax->bins() + 2; ++i ) si += sum[i];
+    for ( int i = 2; i < ax->bins() + 2; ++i ) si += bin[i].sum;
     return si;
   }
 
@@ -159,7 +159,8 @@ public:
    * @return The number of entries outside the range of the IHistogram.
    */
   int extraEntries() const {
-    return sum[0] + sum[1];
+    syncShards();
+    return bin[0].sum + bin[1].sum;
   }
 
   /**
@@ -168,11 +169,12 @@ public:
    * @return The number of equivalent entries.
    */
   double equivalentBinEntries() const {
+    syncShards();
     double sw = 0.0;
     double sw2 = 0.0;
     for ( int i = 2; i < ax->bins() + 2; ++i ) {
-      sw += sumw[i];
-      sw2 += sumw2[i];
+      sw += bin[i].sumw;
+      sw2 += bin[i].sumw2;
     }
     return sw2/(sw*sw);
   }
@@ -184,8 +186,9 @@ public:
    *
    */
   double sumBinHeights() const {
+    syncShards();
     double sw = 0.0;
-    for ( int i = 2; i < ax->bins() + 2; ++i ) sw += sumw[i];
+    for ( int i = 2; i < ax->bins() + 2; ++i ) sw += bin[i].sumw;
     return sw;
   }
     
@@ -203,7 +206,8 @@ public:
    * @return The sum of the heights of the out-of-range bins.
    */
   double sumExtraBinHeights() const {
-    return sumw[0] + sumw[1];
+    syncShards();
+    return bin[0].sumw + bin[1].sumw;
   }
 
   /**
@@ -212,8 +216,10 @@ public:
    * @return The minimum height among the in-range bins.
    */
   double minBinHeight() const {
-    double minw = sumw[2];
-    for ( int i = 3; i < ax->bins() + 2; ++i ) minw = std::min(minw, sumw[i]);
+    syncShards();
+    double minw = bin[2].sumw;
+    for ( int i = 3; i < ax->bins() + 2; ++i )
+      minw = std::min(minw, bin[i].sumw);
     return minw;
   }
 
@@ -223,8 +229,10 @@ public:
    * @return The maximum height among the in-range bins.
    */
   double maxBinHeight() const{
-    double maxw = sumw[2];
-    for ( int i = 3; i < ax->bins() + 2; ++i ) maxw = std::max(maxw, sumw[i]);
+    syncShards();
+    double maxw = bin[2].sumw;
+    for ( int i = 3; i < ax->bins() + 2; ++i )
+      maxw = std::max(maxw, bin[i].sumw);
     return maxw;
   }
 
@@ -236,23 +244,109 @@ public:
    * @return false If the weight is <0 or >1 (?).
    */
   bool fill(double x, double weight = 1.) {
-    int i = ax->coordToIndex(x) + 2;
-    ++sum[i];
-    sumw[i] += weight;
-    sumxw[i] += x*weight;
-    sumx2w[i] += x*x*weight;
-    sumw2[i] += weight*weight;
+    int i = ( fax? fax->Axis::coordToIndex(x):
+	      vax->VariAxis::coordToIndex(x) ) + 2;
+    fillBins()[i].add(x, weight);
     return weight >= 0 && weight <= 1;
   }
 
+  /**
+   * Fill the histogram with \a n values in one go. This is equivalent
+   * to calling fill(double,double) for each value, but the bin
+   * numbers are first calculated for a whole block of values without
+   * going through the virtual IAxis interface.
+   * @param x      Array of \a n values to be filled in.
+   * @param w      Array of \a n corresponding weights. If null all
+   *               weights are taken to be 1.
+   * @param n      The number of values.
+   * @return false If any weight is <0 or >1 (?).
+   */
+  bool fill(const double * x, const double * w, int n) {
+    const int block = 64;
+    int index[block];
+    bool ok = true;
+    std::vector<BinData> & bins = fillBins();
+    for ( int i0 = 0; i0 < n; i0 += block ) {
+      const int nb = std::min(block, n - i0);
+      if ( fax ) fax->coordToIndex(x + i0, index, nb);
+      else vax->coordToIndex(x + i0, index, nb);
+      for ( int i = 0; i < nb; ++i ) {
+	double weight = w? w[i0 + i]: 1.0;
+	bins[index[i] + 2].add(x[i0 + i], weight);
+	ok = ok && weight >= 0 && weight <= 1;
+      }
+    }
+    return ok;
+  }
+
+  /**
+   * Fill the histogram with the values in \a x with the corresponding
+   * weights in \a w, which must either be empty (all weights are 1)
+   * or have the same size as \a x.
+   * @return false If any weight is <0 or >1 (?).
+   */
+  bool fill(const std::vector<double> & x, const std::vector<double> & w) {
+    if ( !w.empty() && w.size() != x.size() )
+      throw std::runtime_error("LWH::Histogram1D::fill: values and weights "
+			       "have different sizes");
+    if ( x.empty() ) return true;
+    return fill(&x[0], w.empty()? 0: &w[0], x.size());
+  }
+
+  /**
+   * Fill the same value \a x into each of the histograms in \a hists
+   * with the corresponding weight in \a w. This is typically used
+   * for a set of histograms of the same observable, one for each
+   * variation weight of an event. If all histograms have the same
+   * binning, the bin is only looked up once. Null pointers in \a
+   * hists are skipped.
+   * @param hists  The histograms to be filled.
+   * @param x      The value to be filled in.
+   * @param w      Array of weights, one for each histogram.
+   * @return false If any weight is <0 or >1 (?).
+   */
+  static bool fill(const std::vector<Histogram1D *> & hists,
+		   double x, const double * w) {
+    bool ok = true;
+    const Histogram1D * last = 0;
+    int i = 0;
+    for ( int j = 0, N = hists.size(); j < N; ++j ) {
+      Histogram1D * h = hists[j];
+      if ( !h ) continue;
+      if ( !last || !h->sameBinning(*last) )
+	i = ( h->fax? h->fax->Axis::coordToIndex(x):
+	      h->vax->VariAxis::coordToIndex(x) ) + 2;
+      last = h;
+      h->fillBins()[i].add(x, w[j]);
+      ok = ok && w[j] >= 0 && w[j] <= 1;
+    }
+    return ok;
+  }
+
+  /**
+   * Fill the same value \a x into each of the histograms in \a hists
+   * with the corresponding weight in \a w, which must have the same
+   * size as \a hists.
+   * @return false If any weight is <0 or >1 (?).
+   */
+  static bool fill(const std::vector<Histogram1D *> & hists,
+		   double x, const std::vector<double> & w) {
+    if ( w.size() != hists.size() )
+      throw std::runtime_error("LWH::Histogram1D::fill: histograms and "
+			       "weights have different sizes");
+    if ( w.empty() ) return true;
+    return fill(hists, x, &w[0]);
+  }
+
   /**
    * The weighted mean of a bin. 
    * @param index The bin number (0...N-1) or OVERFLOW or UNDERFLOW.
    * @return      The mean of the corresponding bin.
    */
   double binMean(int index) const {
+    syncShards();
     int i = index + 2;
-    return sumw[i] != 0.0? sumxw[i]/sumw[i]:
+    return bin[i].sumw != 0.0? bin[i].sumxw/bin[i].sumw:
       ( vax? vax->binMidPoint(index): fax->binMidPoint(index) );
   };
 
@@ -262,9 +356,10 @@ public:
    * @return      The RMS of the corresponding bin.
    */
   double binRms(int index) const {
-    int i = index + 2;
-    return sumw[i] == 0.0 || sum[i] < 2? ax->binWidth(index):
-      std::sqrt(std::max(sumw[i]*sumx2w[i] - sumxw[i]*sumxw[i], 0.0))/sumw[i];
+    syncShards();
+    const BinData & b = bin[index + 2];
+    return b.sumw == 0.0 || b.sum < 2? ax->binWidth(index):
+      std::sqrt(std::max(b.sumw*b.sumx2w - b.sumxw*b.sumxw, 0.0))/b.sumw;
   };
 
   /**
@@ -274,7 +369,8 @@ public:
    * @return      The number of entries in the corresponding bin. 
    */
   int binEntries(int index) const {
-    return sum[index + 2];
+    syncShards();
+    return bin[index + 2].sum;
   }
 
   /**
@@ -284,7 +380,8 @@ public:
    * @return      The height of the corresponding bin.
    */
   double binHeight(int index) const {
-    return sumw[index + 2];
+    syncShards();
+    return bin[index + 2].sumw;
   }
 
   /**
@@ -294,7 +391,8 @@ public:
    *
    */
   double binError(int index) const {
-    return std::sqrt(sumw2[index + 2]);
+    syncShards();
+    return std::sqrt(bin[index + 2].sumw2);
   }
 
   /**
@@ -302,11 +400,12 @@ public:
    * @return The mean of the IHistogram1D.
    */
   double mean() const {
+    syncShards();
     double s = 0.0;
     double sx = 0.0;
     for ( int i = 2; i < ax->bins() + 2; ++i ) {
-      s += sumw[i];
-      sx += sumxw[i];
+      s += bin[i].sumw;
+      sx += bin[i].sumxw;
     }
     return s != 0.0? sx/s: 0.0;
   }
@@ -316,13 +415,14 @@ public:
    * @return The RMS if the IHistogram1D.
    */
   double rms() const {
+    syncShards();
     double s = 0.0;
     double sx = 0.0;
     double sx2 = 0.0;
     for ( int i = 2; i < ax->bins() + 2; ++i ) {
-      s += sumw[i];
-      sx += sumxw[i];
-      sx2 += sumx2w[i];
+      s += bin[i].sumw;
+      sx += bin[i].sumxw;
+      sx2 += bin[i].sumx2w;
     }
     return s != 0.0? std::sqrt(std::max(s*sx2 - sx*sx, 0.0))/s:
       ax->upperEdge() - ax->lowerEdge();
@@ -356,16 +456,57 @@ public:
     if ( ax->upperEdge() != h.ax->upperEdge() ||
 	 ax->lowerEdge() != h.ax->lowerEdge() ||
 	 ax->bins() != h.ax->bins() ) return false;
+    syncShards();
+    h.syncShards();
     for ( int i = 0; i < ax->bins() + 2; ++i ) {
-      sum[i] += h.sum[i];
-      sumw[i] += h.sumw[i];
-      sumxw[i] += h.sumxw[i];
-      sumx2w[i] += h.sumx2w[i];
-      sumw2[i] += h.sumw2[i];
+      bin[i].sum += h.bin[i].sum;
+      bin[i].sumw += h.bin[i].sumw;
+      bin[i].sumxw += h.bin[i].sumxw;
+      bin[i].sumx2w += h.bin[i].sumx2w;
+      bin[i].sumw2 += h.bin[i].sumw2;
     }
     return true;
   }
 
+  /**
+   * Add the contents of all the histograms in \a hs to this one. The
+   * result is the same irrespective of the order of the histograms,
+   * bit by bit.
+   * @return false If the binnings are incompatible.
+   */
+  bool add(const std::vector<const Histogram1D *> & hs) {
+    syncShards();
+    std::vector<const std::vector<BinData> *> parts(1, &bin);
+    for ( int i = 0, N = hs.size(); i < N; ++i ) {
+      const IAxis * hax = hs[i]->ax;
+      if ( ax->upperEdge() != hax->upperEdge() ||
+	   ax->lowerEdge() != hax->lowerEdge() ||
+	   ax->bins() != hax->bins() ) return false;
+      hs[i]->syncShards();
+      parts.push_back(&hs[i]->bin);
+    }
+    mergeBins(parts);
+    return true;
+  }
+
+  /**
+   * Prepare the histogram to be filled from \a n shards. All functions
+   * reading the contents of the histogram first merge the shards, and
+   * must therefore not be called while other shards are being filled.
+   */
+  void setShards(int n) {
+    syncShards();
+    shards.assign(std::max(n - 1, 0), std::vector<BinData>());
+  }
+
+  /**
+   * Add the contents of all shards to the histogram itself and reset
+   * the shards.
+   */
+  void mergeShards() {
+    syncShards();
+  }
+
   /**
    * Add to this IHistogram1D the contents of another IHistogram1D.
    * @param hist The IHistogram1D to be added to this IHistogram1D.
@@ -380,11 +521,13 @@ public:
    * @param s the scaling factor to use.
    */
   bool scale(double s) {
+    syncShards();
+    normalized = true;
     for ( int i = 0; i < ax->bins() + 2; ++i ) {
-      sumw[i] *= s;
-      sumxw[i] *= s;
-      sumx2w[i] *= s;
-      sumw2[i] *= s*s;
+      bin[i].sumw *= s;
+      bin[i].sumxw *= s;
+      bin[i].sumx2w *= s;
+      bin[i].sumw2 *= s*s;
     }
     return true;
   }
@@ -397,26 +540,39 @@ public:
    * scale(double) function.
    */
   void normalize(double intg) {
+    syncShards();
+    normalized = true;
     double oldintg = sumAllBinHeights();
     if ( oldintg == 0.0 ) return;
     for ( int i = 0; i < ax->bins() + 2; ++i ) {
       double fac = intg/oldintg;
       if ( i >= 2 ) fac /= (ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
-      sumw[i] *= fac;
-      sumxw[i] *= fac;
-      sumx2w[i] *= fac;
-      sumw2[i] *= fac*fac;
+      bin[i].sumw *= fac;
+      bin[i].sumxw *= fac;
+      bin[i].sumx2w *= fac;
+      bin[i].sumw2 *= fac*fac;
     }
   }
 
+  /**
+   * Return true if normalize() or scale() has been called for this
+   * histogram, in which case it is averaged rather than added when
+   * merged with histograms from other runs (see Tree::merge()).
+   */
+  bool isNormalized() const {
+    return normalized;
+  }
+
   /**
    * Return the integral over the histogram bins assuming it has been
    * normalize()d.
    */
   double integral() const {
-    double intg = sumw[0] + sumw[1];
+    syncShards();
+    double intg = bin[0].sumw + bin[1].sumw;
     for ( int i = 2; i < ax->bins() + 2; ++i )
-      intg += sumw[i]*(ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
+      intg += bin[i].sumw*
+	(ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
     return intg;
   }
 
@@ -432,6 +588,7 @@ public:
    * Write out the histogram in the AIDA xml format.
    */
   bool writeXML(std::ostream & os, std::string path, std::string name) {
+    syncShards();
     os << "  <histogram1d name=\"" << name
        << "\"\n    title=\"" << title()
        << "\" path=\"" << path
@@ -451,15 +608,15 @@ public:
        << "\">\n      <statistic mean=\"" << mean()
        << "\" direction=\"x\"\n        rms=\"" << rms()
        << "\"/>\n    </statistics>\n    <data1d>\n";
-    for ( int i = 0; i < ax->bins() + 2; ++i ) if ( sum[i] ) {
+    for ( int i = 0; i < ax->bins() + 2; ++i ) if ( bin[i].sum ) {
       os << "      <bin1d binNum=\"";
       if ( i == 0 ) os << "UNDERFLOW";
       else if ( i == 1 ) os << "OVERFLOW";
       else os << i - 2;
-      os << "\" entries=\"" << sum[i]
-	 << "\" height=\"" << sumw[i]
-	 << "\"\n        error=\"" << std::sqrt(sumw2[i])
-	 << "\" error2=\"" << sumw2[i]
+      os << "\" entries=\"" << bin[i].sum
+	 << "\" height=\"" << bin[i].sumw
+	 << "\"\n        error=\"" << std::sqrt(bin[i].sumw2)
+	 << "\" error2=\"" << bin[i].sumw2
 	 << "\"\n        weightedMean=\"" << binMean(i - 2)
 	 << "\" weightedRms=\"" << binRms(i - 2)
 	 << "\"/>\n";
@@ -474,16 +631,69 @@ public:
    * eg. gnuplot to read. The coloums are layed out as 'x w w2 n'.
    */
   bool writeFLAT(std::ostream & os, std::string path, std::string name) {
+    syncShards();
     os << "# " << path << "/" << name << " " << ax->lowerEdge()
        << " " << ax->bins() << " " << ax->upperEdge()
        << " \"" << title() << " \"" << std::endl;
     for ( int i = 2; i < ax->bins() + 2; ++i )
       os << 0.5*(ax->binLowerEdge(i - 2) + ax->binUpperEdge(i - 2)) << " "
-	 << sumw[i] << " " << sqrt(sumw2[i]) << " " << sum[i] << std::endl;
+	 << bin[i].sumw << " " << sqrt(bin[i].sumw2) << " " << bin[i].sum
+	 << std::endl;
     os << std::endl;
     return true;
   }
 
+  /**
+   * Write out the histogram in the compact binary format, including
+   * the sums for all bins.
+   */
+  bool writeBinary(std::ostream & os, std::string path, std::string name) {
+    syncShards();
+    binaryOut(os, int(histogram1DTag));
+    binaryOut(os, path);
+    binaryOut(os, name);
+    binaryOut(os, title());
+    binaryOut(os, char(normalized? 1: 0));
+    axisOut(os, *ax);
+    for ( int i = 0, N = bin.size(); i < N; ++i ) {
+      binaryOut(os, bin[i].sum);
+      binaryOut(os, bin[i].sumw);
+      binaryOut(os, bin[i].sumw2);
+      binaryOut(os, bin[i].sumxw);
+      binaryOut(os, bin[i].sumx2w);
+    }
+    return os.good();
+  }
+
+  /**
+   * Read a histogram written by writeBinary() from the stream \a is,
+   * where the type tag, path and name have already been read.
+   * @return the new histogram or null if the read failed.
+   */
+  static Histogram1D * readBinary(std::istream & is) {
+    std::string title;
+    char norm = 0;
+    bool fixed = true;
+    int nbins = 0;
+    std::vector<double> edges;
+    if ( !binaryIn(is, title) || !binaryIn(is, norm) ||
+	 !axisIn(is, fixed, nbins, edges) ) return 0;
+    Histogram1D * h = fixed? new Histogram1D(nbins, edges[0], edges[1]):
+      new Histogram1D(edges);
+    h->setTitle(title);
+    h->normalized = norm != 0;
+    for ( int i = 0, N = h->bin.size(); i < N; ++i ) {
+      BinData & b = h->bin[i];
+      if ( !binaryIn(is, b.sum) || !binaryIn(is, b.sumw) ||
+	   !binaryIn(is, b.sumw2) || !binaryIn(is, b.sumxw) ||
+	   !binaryIn(is, b.sumx2w) ) {
+	delete h;
+	return 0;
+      }
+    }
+    return h;
+  }
+
 private:
 
   /** The title */
@@ -498,20 +708,114 @@ private:
   /** Pointer (possibly null) to a axis with fixed bin width. */
   VariAxis * vax;
 
-  /** The counts. */
-  std::vector<int> sum;
+  /**
+   * The accumulated sums for one bin. They are kept together so that
+   * filling a bin only touches a single cache line.
+   */
+  struct BinData {
+
+    /** Default constructor. */
+    BinData(): sum(0), sumw(0.0), sumw2(0.0), sumxw(0.0), sumx2w(0.0) {}
+
+    /** Add the value \a x with weight \a w. */
+    void add(double x, double w) {
+      ++sum;
+      sumw += w;
+      sumxw += x*w;
+      sumx2w += x*x*w;
+      sumw2 += w*w;
+    }
 
-  /** The weights. */
-  std::vector<double> sumw;
+    /** The counts. */
+    int sum;
 
-  /** The squared weights. */
-  std::vector<double> sumw2;
+    /** The weights. */
+    double sumw;
 
-  /** The weighted x-values. */
-  std::vector<double> sumxw;
+    /** The squared weights. */
+    double sumw2;
 
-  /** The weighted x-square-values. */
-  std::vector<double> sumx2w;
+    /** The weighted x-values. */
+    double sumxw;
+
+    /** The weighted x-square-values. */
+    double sumx2w;
+
+  };
+
+  /**
+   * The sums for each bin, starting with underflow and overflow. This
+   * is mutable since the shards are merged into it when the contents
+   * are read.
+   */
+  mutable std::vector<BinData> bin;
+
+  /**
+   * The sums for each bin for the shards 1 and up, if the histogram
+   * is filled from several threads. A shard is empty if it has not
+   * been filled since the last merge.
+   */
+  mutable std::vector< std::vector<BinData> > shards;
+
+  /** True if normalize() or scale() has been called. */
+  bool normalized;
+
+  /**
+   * Return true if \a h has exactly the same bins as this histogram.
+   */
+  bool sameBinning(const Histogram1D & h) const {
+    if ( fax ) return h.fax && fax->bins() == h.fax->bins() &&
+		 fax->lowerEdge() == h.fax->lowerEdge() &&
+		 fax->upperEdge() == h.fax->upperEdge();
+    return h.vax && vax->edges() == h.vax->edges();
+  }
+
+  /**
+   * Return the bins to be filled by the current thread.
+   */
+  std::vector<BinData> & fillBins() {
+    int s = currentShard();
+    if ( s == 0 ) return bin;
+    if ( s < 0 || s > int(shards.size()) )
+      throw std::runtime_error("LWH::Histogram1D: filled from a shard "
+			       "which has not been set up");
+    std::vector<BinData> & b = shards[s - 1];
+    if ( b.empty() ) b.resize(bin.size());
+    return b;
+  }
+
+  /**
+   * Add the contents of the shards filled since the last merge to
+   * the bins and empty the shards.
+   */
+  void syncShards() const {
+    std::vector<const std::vector<BinData> *> parts(1, &bin);
+    for ( int s = 0, S = shards.size(); s < S; ++s )
+      if ( !shards[s].empty() ) parts.push_back(&shards[s]);
+    if ( parts.size() == 1 ) return;
+    mergeBins(parts);
+    for ( int s = 0, S = shards.size(); s < S; ++s ) shards[s].clear();
+  }
+
+  /**
+   * Set the bins to the sum of the corresponding bins in \a parts,
+   * which may include the bins of this histogram.
+   */
+  void mergeBins(const std::vector<const std::vector<BinData> *> & parts) const {
+    std::vector<const BinData *> b(parts.size());
+    for ( int i = 0, N = bin.size(); i < N; ++i ) {
+      BinData sum;
+      for ( int j = 0, M = parts.size(); j < M; ++j ) {
+	b[j] = &(*parts[j])[i];
+	sum.sum += b[j]->sum;
+      }
+      sum.sumw = orderedSum(b, &BinData::sumw);
+      sum.sumw2 = orderedSum(b, &BinData::sumw2);
+      sum.sumxw = orderedSum(b, &BinData::sumxw);
+      sum.sumx2w = orderedSum(b, &BinData::sumx2w);
+      bin[i] = sum;
+    }
+  }
 
 };
 
@@ -29,6 +29,9 @@ namespace LWH {
     /** HistFactory is a friend. */
     friend class HistogramFactory;
 
+    /** Tree is a friend. */
+    friend class Tree;
+
   public:
 
     /**
@@ -36,14 +39,9 @@ namespace LWH {
      */
     Histogram2D(int nx, double lox, double upx,
 		int ny, double loy, double upy)
-      : xfax(new Axis(nx, lox, upx)), xvax(0), yfax(new Axis(ny, loy, upy)),
-	sum(nx + 2, std::vector<int>(ny + 2)),
-	sumw(nx + 2, std::vector<double>(ny + 2)),
-	sumw2(nx + 2, std::vector<double>(ny + 2)),
-	sumxw(nx + 2, std::vector<double>(ny + 2)),
-	sumx2w(nx + 2, std::vector<double>(ny + 2)),
-	sumyw(nx + 2, std::vector<double>(ny + 2)),
-	sumy2w(nx + 2, std::vector<double>(ny + 2)) {
+      : xfax(new Axis(nx, lox, upx)), xvax(0),
+	yfax(new Axis(ny, loy, upy)), yvax(0),
+	bin(nx + 2, std::vector<BinData>(ny + 2)), normalized(false) {
       xax = xfax;
       yax = yfax;
     }
@@ -54,27 +52,48 @@ namespace LWH {
     Histogram2D(const std::vector<double> & xedges,
 		const std::vector<double> & yedges)
       : xfax(0), xvax(new VariAxis(xedges)),
-	yfax(0), yvax(new VariAxis(xedges)),
-        sum(xedges.size() + 1, std::vector<int>(yedges.size() + 1)),
-	sumw(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-	sumw2(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-        sumxw(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-	sumx2w(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-        sumyw(xedges.size() + 1, std::vector<double>(yedges.size() + 1)),
-	sumy2w(xedges.size() + 1, std::vector<double>(yedges.size() + 1)) {
+	yfax(0), yvax(new VariAxis(yedges)),
+        bin(xedges.size() + 1, std::vector<BinData>(yedges.size() + 1)),
+	normalized(false) {
       xax = xvax;
       yax = yvax;
     }
 
+    /**
+     * Standard constructor for variable bin width in x and fixed bin
+     * width in y.
+     */
+    Histogram2D(const std::vector<double> & xedges,
+		int ny, double loy, double upy)
+      : xfax(0), xvax(new VariAxis(xedges)),
+	yfax(new Axis(ny, loy, upy)), yvax(0),
+        bin(xedges.size() + 1, std::vector<BinData>(ny + 2)),
+	normalized(false) {
+      xax = xvax;
+      yax = yfax;
+    }
+
+    /**
+     * Standard constructor for fixed bin width in x and variable bin
+     * width in y.
+     */
+    Histogram2D(int nx, double lox, double upx,
+		const std::vector<double> & yedges)
+      : xfax(new Axis(nx, lox, upx)), xvax(0),
+	yfax(0), yvax(new VariAxis(yedges)),
+        bin(nx + 2, std::vector<BinData>(yedges.size() + 1)),
+	normalized(false) {
+      xax = xfax;
+      yax = yvax;
+    }
+
     /**
      * Copy constructor.
      */
     Histogram2D(const Histogram2D & h)
       : IBaseHistogram(h), IHistogram(h), IHistogram2D(h), ManagedObject(h),
         xfax(0), xvax(0),  yfax(0), yvax(0),
-	sum(h.sum), sumw(h.sumw), sumw2(h.sumw2),
-        sumxw(h.sumxw), sumx2w(h.sumx2w) ,
-        sumyw(h.sumyw), sumy2w(h.sumy2w){
+	bin(h.bin), shards(h.shards), normalized(h.normalized) {
       const VariAxis * hxvax = dynamic_cast<const VariAxis *>(h.xax);
       if ( hxvax ) xax = xvax = new VariAxis(*hxvax);
       else xax = xfax = new Axis(dynamic_cast<const Axis &>(*h.xax));
@@ -146,13 +165,9 @@ namespace LWH {
     bool reset() {
       const int nx = xax->bins() + 2;
       const int ny = yax->bins() + 2;
-      sum = std::vector< std::vector<int> >(nx, std::vector<int>(ny));
-      sumw = std::vector< std::vector<double> >(nx, std::vector<double>(ny));
-      sumw2 = sumw;
-      sumxw = sumw;
-      sumx2w = sumw;
-      sumyw = sumw;
-      sumy2w = sumw;
+      bin = std::vector< std::vector<BinData> >(nx, std::vector<BinData>(ny));
+      for ( int s = 0, S = shards.size(); s < S; ++s ) shards[s].clear();
+      normalized = false;
       return true;
     }
 
@@ -162,9 +177,10 @@ namespace LWH {
      *
      */
     int entries() const {
+      syncShards();
       int si = 0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) si += sum[ix][iy];
+	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) si += bin[ix][iy].sum;
       return si;
     }
 
@@ -184,11 +200,12 @@ namespace LWH {
      * @return The number of entries outside the range of the IHistogram.
      */
     int extraEntries() const {
-      int esum = sum[0][0] + sum[1][0] + sum[0][1] + sum[1][1];
+      syncShards();
+      int esum = bin[0][0].sum + bin[1][0].sum + bin[0][1].sum + bin[1][1].sum;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	esum += sum[ix][0] + sum[ix][1];
+	esum += bin[ix][0].sum + bin[ix][1].sum;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	esum += sum[0][iy] + sum[1][iy];
+	esum += bin[0][iy].sum + bin[1][iy].sum;
       return esum;
     }
 
@@ -198,12 +215,13 @@ namespace LWH {
      * @return The number of equivalent entries.
      */
     double equivalentBinEntries() const {
+      syncShards();
       double sw = 0.0;
       double sw2 = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-	  sw += sumw[ix][iy];
-	  sw2 += sumw2[ix][iy];
+	  sw += bin[ix][iy].sumw;
+	  sw2 += bin[ix][iy].sumw2;
 	}
       return sw2/(sw*sw);
     }
@@ -215,9 +233,10 @@ namespace LWH {
      *
      */
     double sumBinHeights() const {
+      syncShards();
       double sw = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) sw += sumw[ix][iy];
+	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) sw += bin[ix][iy].sumw;
       return sw;
     }
 
@@ -235,11 +254,13 @@ namespace LWH {
      * @return The sum of the heights of the out-of-range bins.
      */
     double sumExtraBinHeights() const {
-      int esum = sumw[0][0] + sumw[1][0] + sumw[0][1] + sumw[1][1];
+      syncShards();
+      int esum = bin[0][0].sumw + bin[1][0].sumw +
+	bin[0][1].sumw + bin[1][1].sumw;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	esum += sumw[ix][0] + sumw[ix][1];
+	esum += bin[ix][0].sumw + bin[ix][1].sumw;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	esum += sumw[0][iy] + sumw[1][iy];
+	esum += bin[0][iy].sumw + bin[1][iy].sumw;
       return esum;
     }
 
@@ -249,10 +270,11 @@ namespace LWH {
      * @return The minimum height among the in-range bins.
      */
     double minBinHeight() const {
-      double minw = sumw[2][2];
+      syncShards();
+      double minw = bin[2][2].sumw;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	  minw = std::min(minw, sumw[ix][iy]);
+	  minw = std::min(minw, bin[ix][iy].sumw);
       return minw;
     }
 
@@ -262,10 +284,11 @@ namespace LWH {
      * @return The maximum height among the in-range bins.
      */
     double maxBinHeight() const{
-      double maxw = sumw[2][2];
+      syncShards();
+      double maxw = bin[2][2].sumw;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	  maxw = std::max(maxw, sumw[ix][iy]);
+	  maxw = std::max(maxw, bin[ix][iy].sumw);
       return maxw;
     }
 
@@ -277,18 +300,47 @@ namespace LWH {
      * @return false If the weight is <0 or >1 (?).
      */
     bool fill(double x, double y, double weight = 1.) {
-      int ix = xax->coordToIndex(x) + 2;
-      int iy = yax->coordToIndex(y) + 2;
-      ++sum[ix][iy];
-      sumw[ix][iy] += weight;
-      sumxw[ix][iy] += x*weight;
-      sumx2w[ix][iy] += x*x*weight;
-      sumyw[ix][iy] += y*weight;
-      sumy2w[ix][iy] += y*y*weight;
-      sumw2[ix][iy] += weight*weight;
+      int ix = ( xfax? xfax->Axis::coordToIndex(x):
+		 xvax->VariAxis::coordToIndex(x) ) + 2;
+      int iy = ( yfax? yfax->Axis::coordToIndex(y):
+		 yvax->VariAxis::coordToIndex(y) ) + 2;
+      fillBins()[ix][iy].add(x, y, weight);
       return weight >= 0 && weight <= 1;
     }
 
+    /**
+     * Fill the histogram with \a n pairs of values in one go. This is
+     * equivalent to calling fill(double,double,double) for each pair,
+     * but the bin numbers are first calculated for a whole block of
+     * values without going through the virtual IAxis interface.
+     * @param x      Array of \a n x-values to be filled in.
+     * @param y      Array of \a n y-values to be filled in.
+     * @param w      Array of \a n corresponding weights. If null all
+     *               weights are taken to be 1.
+     * @param n      The number of values.
+     * @return false If any weight is <0 or >1 (?).
+     */
+    bool fill(const double * x, const double * y, const double * w, int n) {
+      const int block = 64;
+      int xindex[block];
+      int yindex[block];
+      bool ok = true;
+      BinArray & bins = fillBins();
+      for ( int i0 = 0; i0 < n; i0 += block ) {
+	const int nb = std::min(block, n - i0);
+	if ( xfax ) xfax->coordToIndex(x + i0, xindex, nb);
+	else xvax->coordToIndex(x + i0, xindex, nb);
+	if ( yfax ) yfax->coordToIndex(y + i0, yindex, nb);
+	else yvax->coordToIndex(y + i0, yindex, nb);
+	for ( int i = 0; i < nb; ++i ) {
+	  double weight = w? w[i0 + i]: 1.0;
+	  bins[xindex[i] + 2][yindex[i] + 2].add(x[i0 + i], y[i0 + i], weight);
+	  ok = ok && weight >= 0 && weight <= 1;
+	}
+      }
+      return ok;
+    }
+
     /**
      * The weighted mean along the x-axis of a bin.
      * @param xindex The bin number (0...N-1) or OVERFLOW or UNDERFLOW.
@@ -296,9 +348,10 @@ namespace LWH {
      * @return      The mean of the corresponding bin.
      */
     double binMeanX(int xindex, int yindex) const {
+      syncShards();
       int ix = xindex + 2;
       int iy = yindex + 2;
-      return sumw[ix][iy] != 0.0? sumxw[ix][iy]/sumw[ix][iy]:
+      return bin[ix][iy].sumw != 0.0? bin[ix][iy].sumxw/bin[ix][iy].sumw:
         ( xvax? xvax->binMidPoint(xindex): xfax->binMidPoint(xindex) );
     };
 
@@ -309,10 +362,11 @@ namespace LWH {
      * @return      The mean of the corresponding bin.
      */
     double binMeanY(int xindex, int yindex) const {
+      syncShards();
       int ix = xindex + 2;
       int iy = yindex + 2;
-      return sumw[ix][iy] != 0.0? sumyw[ix][iy]/sumw[ix][iy]:
-        ( yvax? yvax->binMidPoint(yindex): xfax->binMidPoint(yindex) );
+      return bin[ix][iy].sumw != 0.0? bin[ix][iy].sumyw/bin[ix][iy].sumw:
+        ( yvax? yvax->binMidPoint(yindex): yfax->binMidPoint(yindex) );
     };
 
     /**
@@ -322,11 +376,10 @@ namespace LWH {
      * @return      The RMS of the corresponding bin.
      */
     double binRmsX(int xindex, int yindex) const {
-      int ix = xindex + 2;
-      int iy = yindex + 2;
-      return sumw[ix][iy] == 0.0 || sum[ix][iy] < 2? xax->binWidth(xindex):
-        std::sqrt(std::max(sumw[ix][iy]*sumx2w[ix][iy] -
-			   sumxw[ix][iy]*sumxw[ix][iy], 0.0))/sumw[ix][iy];
+      syncShards();
+      const BinData & b = bin[xindex + 2][yindex + 2];
+      return b.sumw == 0.0 || b.sum < 2? xax->binWidth(xindex):
+        std::sqrt(std::max(b.sumw*b.sumx2w - b.sumxw*b.sumxw, 0.0))/b.sumw;
     };
 
     /**
@@ -336,11 +389,10 @@ namespace LWH {
      * @return      The RMS of the corresponding bin.
      */
     double binRmsY(int xindex, int yindex) const {
-      int ix = xindex + 2;
-      int iy = yindex + 2;
-      return sumw[ix][iy] == 0.0 || sum[ix][iy] < 2? yax->binWidth(yindex):
-        std::sqrt(std::max(sumw[ix][iy]*sumy2w[ix][iy] -
-			   sumyw[ix][iy]*sumyw[ix][iy], 0.0))/sumw[ix][iy];
+      syncShards();
+      const BinData & b = bin[xindex + 2][yindex + 2];
+      return b.sumw == 0.0 || b.sum < 2? yax->binWidth(yindex):
+        std::sqrt(std::max(b.sumw*b.sumy2w - b.sumyw*b.sumyw, 0.0))/b.sumw;
     };
 
     /**
@@ -350,7 +402,8 @@ namespace LWH {
      * @return      The number of entries in the corresponding bin.
      */
     int binEntries(int xindex, int yindex) const {
-      return sum[xindex + 2][yindex + 2];
+      syncShards();
+      return bin[xindex + 2][yindex + 2].sum;
     }
 
     /**
@@ -361,9 +414,10 @@ namespace LWH {
      *
      */
     virtual int binEntriesX(int index) const {
+      syncShards();
       int ret = 0;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	ret += sum[index + 2][iy];
+	ret += bin[index + 2][iy].sum;
       return ret;
     }
 
@@ -375,9 +429,10 @@ namespace LWH {
      *
      */
     virtual int binEntriesY(int index) const {
+      syncShards();
       int ret = 0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	ret += sum[ix][index + 2];
+	ret += bin[ix][index + 2].sum;
       return ret;
     }
 
@@ -388,9 +443,10 @@ namespace LWH {
      * @return      The height of the corresponding bin.
      */
     double binHeight(int xindex, int yindex) const {
+      syncShards();
       /// @todo While this is compatible with the reference AIDA
       /// implementation, it is not the bin height!
-      return sumw[xindex + 2][yindex + 2];
+      return bin[xindex + 2][yindex + 2].sumw;
     }
 
     /**
@@ -401,9 +457,10 @@ namespace LWH {
      *
      */
     virtual double binHeightX(int index) const {
+      syncShards();
       double ret = 0;
       for ( int iy = 2; iy < yax->bins() + 2; ++iy )
-	ret += sumw[index + 2][iy];
+	ret += bin[index + 2][iy].sumw;
       return ret;
     }
 
@@ -415,9 +472,10 @@ namespace LWH {
      *
      */
     virtual double binHeightY(int index) const {
+      syncShards();
       double ret = 0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
-	ret += sumw[ix][index + 2];
+	ret += bin[ix][index + 2].sumw;
       return ret;
     }
 
@@ -428,7 +486,8 @@ namespace LWH {
      *
      */
     double binError(int xindex, int yindex) const {
-      return std::sqrt(sumw2[xindex + 2][yindex + 2]);
+      syncShards();
+      return std::sqrt(bin[xindex + 2][yindex + 2].sumw2);
     }
 
     /**
@@ -437,12 +496,13 @@ namespace LWH {
      *
      */
     double meanX() const {
+      syncShards();
       double s = 0.0;
       double sx = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sx += sumxw[ix][iy];
+        s += bin[ix][iy].sumw;
+        sx += bin[ix][iy].sumxw;
       }
       return s != 0.0? sx/s: 0.0;
     }
@@ -453,12 +513,13 @@ namespace LWH {
      *
      */
     double meanY() const {
+      syncShards();
       double s = 0.0;
       double sy = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sy += sumyw[ix][iy];
+        s += bin[ix][iy].sumw;
+        sy += bin[ix][iy].sumyw;
       }
       return s != 0.0? sy/s: 0.0;
     }
@@ -469,14 +530,15 @@ namespace LWH {
      *
      */
     double rmsX() const {
+      syncShards();
       double s = 0.0;
       double sx = 0.0;
       double sx2 = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sx += sumxw[ix][iy];
-        sx2 += sumx2w[ix][iy];
+        s += bin[ix][iy].sumw;
+        sx += bin[ix][iy].sumxw;
+        sx2 += bin[ix][iy].sumx2w;
       }
       return s != 0.0? std::sqrt(std::max(s*sx2 - sx*sx, 0.0))/s:
         xax->upperEdge() - xax->lowerEdge();
@@ -488,14 +550,15 @@ namespace LWH {
      *
      */
     double rmsY() const {
+      syncShards();
       double s = 0.0;
       double sy = 0.0;
       double sy2 = 0.0;
       for ( int ix = 2; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy ) {
-        s += sumw[ix][iy];
-        sy += sumyw[ix][iy];
-        sy2 += sumy2w[ix][iy];
+        s += bin[ix][iy].sumw;
+        sy += bin[ix][iy].sumyw;
+        sy2 += bin[ix][iy].sumy2w;
       }
       return s != 0.0? std::sqrt(std::max(s*sy2 - sy*sy, 0.0))/s:
         yax->upperEdge() - yax->lowerEdge();
@@ -503,32 +566,38 @@ namespace LWH {
 
     /** The weights. */
     double getSumW(int xindex, int yindex) const {
-        return sumw[xindex + 2][yindex + 2];
+      syncShards();
+        return bin[xindex + 2][yindex + 2].sumw;
     }
 
     /** The squared weights. */
     double getSumW2(int xindex, int yindex) const {
-        return sumw2[xindex + 2][yindex + 2];
+      syncShards();
+        return bin[xindex + 2][yindex + 2].sumw2;
     }
 
     /** The weighted x-values. */
     double getSumXW(int xindex, int yindex) const {
-        return sumxw[xindex + 2][yindex + 2];
+      syncShards();
+        return bin[xindex + 2][yindex + 2].sumxw;
     }
 
     /** The weighted x-square-values. */
     double getSumX2W(int xindex, int yindex) const {
-        return sumx2w[xindex + 2][yindex + 2];
+      syncShards();
+        return bin[xindex + 2][yindex + 2].sumx2w;
     }
     
     /** The weighted x-values. */
     double getSumYW(int xindex, int yindex) const {
-        return sumyw[xindex + 2][yindex + 2];
+      syncShards();
+        return bin[xindex + 2][yindex + 2].sumyw;
     }
 
     /** The weighted x-square-values. */
     double getSumY2W(int xindex, int yindex) const {
-        return sumy2w[xindex + 2][yindex + 2];
+      syncShards();
+        return bin[xindex + 2][yindex + 2].sumy2w;
     }
     
     /**
@@ -581,15 +650,17 @@ namespace LWH {
       if ( yax->upperEdge() != h.yax->upperEdge() ||
 	   yax->lowerEdge() != h.yax->lowerEdge() ||
 	   yax->bins() != h.yax->bins() ) return false;
+      syncShards();
+      h.syncShards();
       for ( int ix = 0; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 0; iy < yax->bins() + 2; ++iy ) {
-	  sum[ix][iy] += h.sum[ix][iy];
-	  sumw[ix][iy] += h.sumw[ix][iy];
-	  sumxw[ix][iy] += h.sumxw[ix][iy];
-	  sumx2w[ix][iy] += h.sumx2w[ix][iy];
-	  sumyw[ix][iy] += h.sumyw[ix][iy];
-	  sumy2w[ix][iy] += h.sumy2w[ix][iy];
-	  sumw2[ix][iy] += h.sumw2[ix][iy];
+	  bin[ix][iy].sum += h.bin[ix][iy].sum;
+	  bin[ix][iy].sumw += h.bin[ix][iy].sumw;
+	  bin[ix][iy].sumxw += h.bin[ix][iy].sumxw;
+	  bin[ix][iy].sumx2w += h.bin[ix][iy].sumx2w;
+	  bin[ix][iy].sumyw += h.bin[ix][iy].sumyw;
+	  bin[ix][iy].sumy2w += h.bin[ix][iy].sumy2w;
+	  bin[ix][iy].sumw2 += h.bin[ix][iy].sumw2;
 	}
       return true;
     }
@@ -603,19 +674,64 @@ namespace LWH {
       return add(dynamic_cast<const Histogram2D &>(hist));
     }
 
+    /**
+     * Add the contents of all the histograms in \a hs to this one. The
+     * result is the same irrespective of the order of the histograms,
+     * bit by bit.
+     * @return false If the binnings are incompatible.
+     */
+    bool add(const std::vector<const Histogram2D *> & hs) {
+      syncShards();
+      std::vector<const BinArray *> parts(1, &bin);
+      for ( int i = 0, N = hs.size(); i < N; ++i ) {
+	const Histogram2D & h = *hs[i];
+	if ( xax->upperEdge() != h.xax->upperEdge() ||
+	     xax->lowerEdge() != h.xax->lowerEdge() ||
+	     xax->bins() != h.xax->bins() ) return false;
+	if ( yax->upperEdge() != h.yax->upperEdge() ||
+	     yax->lowerEdge() != h.yax->lowerEdge() ||
+	     yax->bins() != h.yax->bins() ) return false;
+	h.syncShards();
+	parts.push_back(&h.bin);
+      }
+      mergeBins(parts);
+      return true;
+    }
+
+    /**
+     * Prepare the histogram to be filled from \a n shards. All
+     * functions reading the contents of the histogram first merge the
+     * shards, and must therefore not be called while other shards are
+     * being filled.
+     */
+    void setShards(int n) {
+      syncShards();
+      shards.assign(std::max(n - 1, 0), BinArray());
+    }
+
+    /**
+     * Add the contents of all shards to the histogram itself and reset
+     * the shards.
+     */
+    void mergeShards() {
+      syncShards();
+    }
+
     /**
      * Scale the contents of this histogram with the given factor.
      * @param s the scaling factor to use.
      */
     bool scale(double s) {
+      syncShards();
+      normalized = true;
       for ( int ix = 0; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 0; iy < yax->bins() + 2; ++iy ) {
-	  sumw[ix][iy] *= s;
-	  sumxw[ix][iy] *= s;
-	  sumx2w[ix][iy] *= s;
-	  sumyw[ix][iy] *= s;
-	  sumy2w[ix][iy] *= s;
-	  sumw2[ix][iy] *= s*s;
+	  bin[ix][iy].sumw *= s;
+	  bin[ix][iy].sumxw *= s;
+	  bin[ix][iy].sumx2w *= s;
+	  bin[ix][iy].sumyw *= s;
+	  bin[ix][iy].sumy2w *= s;
+	  bin[ix][iy].sumw2 *= s*s;
       }
       return true;
     }
@@ -628,6 +744,8 @@ namespace LWH {
      * scale(double) function.
      */
     void normalize(double intg) {
+      syncShards();
+      normalized = true;
       double oldintg = sumAllBinHeights();
       if ( oldintg == 0.0 ) return;
       for ( int ix = 0; ix < xax->bins() + 2; ++ix )
@@ -636,26 +754,35 @@ namespace LWH {
 	  if ( ix >= 2 && iy >= 2 )
 	    fac /= (xax->binUpperEdge(ix - 2) - xax->binLowerEdge(ix - 2))*
 	      (yax->binUpperEdge(iy - 2) - yax->binLowerEdge(iy - 2));
-        sumw[ix][iy] *= fac;
-        sumxw[ix][iy] *= fac;
-        sumx2w[ix][iy] *= fac;
-        sumyw[ix][iy] *= fac;
-        sumy2w[ix][iy] *= fac;
-        sumw2[ix][iy] *= fac*fac;
+        bin[ix][iy].sumw *= fac;
+        bin[ix][iy].sumxw *= fac;
+        bin[ix][iy].sumx2w *= fac;
+        bin[ix][iy].sumyw *= fac;
+        bin[ix][iy].sumy2w *= fac;
+        bin[ix][iy].sumw2 *= fac*fac;
       }
     }
 
+    /**
+     * Return true if normalize() or scale() has been called for this
+     * histogram, in which case it is averaged rather than added when
+     * merged with histograms from other runs (see Tree::merge()).
+     */
+    bool isNormalized() const {
+      return normalized;
+    }
+
     /**
      * Return the integral over the histogram bins assuming it has been
      * normalize()d.
      */
     // double integral() const {
-    //   double intg = sumw[0] + sumw[1];
+    //   double intg = bin[0].sumw + bin[1].sumw;
     //   for ( int i = 2; i < ax->bins() + 2; ++i )
 
     // is this right? Leave out bin width factor?
 
-    //     intg += sumw[ix][iy]*(ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
+    //     intg += bin[ix][iy].sumw*(ax->binUpperEdge(i - 2) - ax->binLowerEdge(i - 2));
     //   return intg;
     // }
 
@@ -671,6 +798,7 @@ namespace LWH {
      * Write out the histogram in the AIDA xml format.
      */
     bool writeXML(std::ostream & os, std::string path, std::string name) {
+      syncShards();
       //std::cout << "Writing out histogram " << name << " in AIDA file format!" << std::endl;
       os << "  <histogram2d name=\"" << name
          << "\"\n    title=\"" << title()
@@ -707,7 +835,7 @@ namespace LWH {
          << "\"/>\n    </statistics>\n    <data2d>\n";
       for ( int ix = 0; ix < xax->bins() + 2; ++ix )
 	for ( int iy = 0; iy < yax->bins() + 2; ++iy )
-	  if ( sum[ix][iy] ) {
+	  if ( bin[ix][iy].sum ) {
 	    os << "      <bin2d binNumX=\"";
 	    if ( ix == 0 ) os << "UNDERFLOW";
 	    else if ( ix == 1 ) os << "OVERFLOW";
@@ -716,10 +844,10 @@ namespace LWH {
 	    if ( iy == 0 ) os << "UNDERFLOW";
 	    else if ( iy == 1 ) os << "OVERFLOW";
 	    else os << iy - 2;
-	    os << "\" entries=\"" << sum[ix][iy]
-	       << "\" height=\"" << sumw[ix][iy]
-	       << "\"\n        error=\"" << std::sqrt(sumw2[ix][iy])
-	       << "\" error2=\"" << sumw2[ix][iy]
+	    os << "\" entries=\"" << bin[ix][iy].sum
+	       << "\" height=\"" << bin[ix][iy].sumw
+	       << "\"\n        error=\"" << std::sqrt(bin[ix][iy].sumw2)
+	       << "\" error2=\"" << bin[ix][iy].sumw2
 	       << "\"\n        weightedMeanX=\"" << binMeanX(ix - 2, iy - 2)
 	       << "\" weightedRmsX=\"" << binRmsX(ix - 2, iy - 2)
 	       << "\"\n        weightedMeanY=\"" << binMeanY(ix - 2, iy - 2)
@@ -736,6 +864,7 @@ namespace LWH {
      * eg. gnuplot to read. The coloums are layed out as 'x w w2 n'.
      */
     bool writeFLAT(std::ostream & os, std::string path, std::string name) {
+      syncShards();
       os << "#2D " << path << "/" << name << " " << xax->lowerEdge()
          << " " << xax->bins() << " " << xax->upperEdge() << " "
 	 << yax->lowerEdge() << " " << yax->bins() << " " << yax->upperEdge()
@@ -744,14 +873,83 @@ namespace LWH {
 	for ( int iy = 2; iy < yax->bins() + 2; ++iy )
 	  os << 0.5*(xax->binLowerEdge(ix - 2)+xax->binUpperEdge(ix - 2)) << " "
 	     << 0.5*(yax->binLowerEdge(iy - 2)+yax->binUpperEdge(iy - 2))
-	     << " " << sumw[ix][iy] << " " << sqrt(sumw2[ix][iy])
-	     << " " << sum[ix][iy] << std::endl;
+	     << " " << bin[ix][iy].sumw << " " << sqrt(bin[ix][iy].sumw2)
+	     << " " << bin[ix][iy].sum << std::endl;
 	os << std::endl;
       }
       os << std::endl;
       return true;
     }
 
+    /**
+     * Write out the histogram in the compact binary format, including
+     * the sums for all bins.
+     */
+    bool writeBinary(std::ostream & os, std::string path, std::string name) {
+      syncShards();
+      binaryOut(os, int(histogram2DTag));
+      binaryOut(os, path);
+      binaryOut(os, name);
+      binaryOut(os, title());
+      binaryOut(os, char(normalized? 1: 0));
+      axisOut(os, *xax);
+      axisOut(os, *yax);
+      for ( int ix = 0, NX = bin.size(); ix < NX; ++ix )
+	for ( int iy = 0, NY = bin[ix].size(); iy < NY; ++iy ) {
+	  const BinData & b = bin[ix][iy];
+	  binaryOut(os, b.sum);
+	  binaryOut(os, b.sumw);
+	  binaryOut(os, b.sumw2);
+	  binaryOut(os, b.sumxw);
+	  binaryOut(os, b.sumx2w);
+	  binaryOut(os, b.sumyw);
+	  binaryOut(os, b.sumy2w);
+	}
+      return os.good();
+    }
+
+    /**
+     * Read a histogram written by writeBinary() from the stream \a is,
+     * where the type tag, path and name have already been read.
+     * @return the new histogram or null if the read failed.
+     */
+    static Histogram2D * readBinary(std::istream & is) {
+      std::string title;
+      char norm = 0;
+      bool xfixed = true;
+      bool yfixed = true;
+      int nx = 0;
+      int ny = 0;
+      std::vector<double> xedges;
+      std::vector<double> yedges;
+      if ( !binaryIn(is, title) || !binaryIn(is, norm) ||
+	   !axisIn(is, xfixed, nx, xedges) ||
+	   !axisIn(is, yfixed, ny, yedges) ) return 0;
+      Histogram2D * h = 0;
+      if ( xfixed && yfixed )
+	h = new Histogram2D(nx, xedges[0], xedges[1], ny, yedges[0], yedges[1]);
+      else if ( xfixed )
+	h = new Histogram2D(nx, xedges[0], xedges[1], yedges);
+      else if ( yfixed )
+	h = new Histogram2D(xedges, ny, yedges[0], yedges[1]);
+      else
+	h = new Histogram2D(xedges, yedges);
+      h->setTitle(title);
+      h->normalized = norm != 0;
+      for ( int ix = 0, NX = h->bin.size(); ix < NX; ++ix )
+	for ( int iy = 0, NY = h->bin[ix].size(); iy < NY; ++iy ) {
+	  BinData & b = h->bin[ix][iy];
+	  if ( !binaryIn(is, b.sum) || !binaryIn(is, b.sumw) ||
+	       !binaryIn(is, b.sumw2) || !binaryIn(is, b.sumxw) ||
+	       !binaryIn(is, b.sumx2w) || !binaryIn(is, b.sumyw) ||
+	       !binaryIn(is, b.sumy2w) ) {
+	    delete h;
+	    return 0;
+	  }
+	}
+      return h;
+    }
+
 
 
    #ifdef HAVE_ROOT
@@ -783,16 +981,16 @@ namespace LWH {
 
       double entries = 0;
       for ( int i = 0; i < nbins + 2; ++i ) {
-        if ( sum[ix][iy] ) {
+        if ( bin[ix][iy].sum ) {
           //i==0: underflow->RootBin(0), i==1: overflow->RootBin(NBins+1)
-          entries = entries + sum[ix][iy];
+          entries = entries + bin[ix][iy].sum;
           int j=i;
           if (i==0) j=0; //underflow
           else if (i==1) j=nbins+1; //overflow
           if (i>=2) j=i-1; //normal bin entries
-          hist1d->SetBinContent(j, sumw[ix][iy]);
-          hist1d->SetBinError(j, sqrt(sumw2[ix][iy]));
-          //hist1d->Fill(binMean(i), sumw[ix][iy]);
+          hist1d->SetBinContent(j, bin[ix][iy].sumw);
+          hist1d->SetBinError(j, sqrt(bin[ix][iy].sumw2));
+          //hist1d->Fill(binMean(i), bin[ix][iy].sumw);
         }
       }
 
@@ -837,26 +1035,127 @@ namespace LWH {
     /** Pointer (possibly null) to a axis with fixed bin width. */
     VariAxis * yvax;
 
-    /** The counts. */
-    std::vector< std::vector<int> > sum;
+    /**
+     * The accumulated sums for one bin. They are kept together so that
+     * filling a bin only touches a single cache line.
+     */
+    struct BinData {
+
+      /** Default constructor. */
+      BinData()
+	: sum(0), sumw(0.0), sumw2(0.0), sumxw(0.0), sumx2w(0.0),
+	  sumyw(0.0), sumy2w(0.0) {}
+
+      /** Add the values \a x and \a y with weight \a w. */
+      void add(double x, double y, double w) {
+	++sum;
+	sumw += w;
+	sumxw += x*w;
+	sumx2w += x*x*w;
+	sumyw += y*w;
+	sumy2w += y*y*w;
+	sumw2 += w*w;
+      }
 
-    /** The weights. */
-    std::vector< std::vector<double> > sumw;
+      /** The counts. */
+      int sum;
 
-    /** The squared weights. */
-    std::vector< std::vector<double> > sumw2;
+      /** The weights. */
+      double sumw;
 
-    /** The weighted x-values. */
-    std::vector< std::vector<double> > sumxw;
+      /** The squared weights. */
+      double sumw2;
 
-    /** The weighted x-square-values. */
-    std::vector< std::vector<double> > sumx2w;
+      /** The weighted x-values. */
+      double sumxw;
+
+      /** The weighted x-square-values. */
+      double sumx2w;
 
-    /** The weighted y-values. */
-    std::vector< std::vector<double> > sumyw;
+      /** The weighted y-values. */
+      double sumyw;
 
-    /** The weighted y-square-values. */
-    std::vector< std::vector<double> > sumy2w;
+      /** The weighted y-square-values. */
+      double sumy2w;
+
+    };
+
+    /**
+     * The sums for each bin, starting with underflow and overflow in
+     * each direction. This is mutable since the shards are merged into
+     * it when the contents are read.
+     */
+    mutable std::vector< std::vector<BinData> > bin;
+
+    /** A two-dimensional array of bins. */
+    typedef std::vector< std::vector<BinData> > BinArray;
+
+    /**
+     * The sums for each bin for the shards 1 and up, if the histogram
+     * is filled from several threads. A shard is empty if it has not
+     * been filled since the last merge.
+     */
+    mutable std::vector<BinArray> shards;
+
+    /** True if normalize() or scale() has been called. */
+    bool normalized;
+
+    /**
+     * Return an array of empty bins of the same size as bin.
+     */
+    BinArray emptyBins() const {
+      return BinArray(bin.size(), std::vector<BinData>(bin[0].size()));
+    }
+
+    /**
+     * Return the bins to be filled by the current thread.
+     */
+    BinArray & fillBins() {
+      int s = currentShard();
+      if ( s == 0 ) return bin;
+      if ( s < 0 || s > int(shards.size()) )
+	throw std::runtime_error("LWH::Histogram2D: filled from a shard "
+				 "which has not been set up");
+      BinArray & b = shards[s - 1];
+      if ( b.empty() ) b = emptyBins();
+      return b;
+    }
+
+    /**
+     * Add the contents of the shards filled since the last merge to
+     * the bins and empty the shards.
+     */
+    void syncShards() const {
+      std::vector<const BinArray *> parts(1, &bin);
+      for ( int s = 0, S = shards.size(); s < S; ++s )
+	if ( !shards[s].empty() ) parts.push_back(&shards[s]);
+      if ( parts.size() == 1 ) return;
+      mergeBins(parts);
+      for ( int s = 0, S = shards.size(); s < S; ++s ) shards[s].clear();
+    }
+
+    /**
+     * Set the bins to the sum of the corresponding bins in \a parts,
+     * which may include the bins of this histogram.
+     */
+    void mergeBins(const std::vector<const BinArray *> & parts) const {
+      std::vector<const BinData *> b(parts.size());
+      for ( int ix = 0, NX = bin.size(); ix < NX; ++ix )
+	for ( int iy = 0, NY = bin[ix].size(); iy < NY; ++iy ) {
+	  BinData sum;
+	  for ( int j = 0, M = parts.size(); j < M; ++j ) {
+	    b[j] = &(*parts[j])[ix][iy];
+	    sum.sum += b[j]->sum;
+	  }
+	  sum.sumw = orderedSum(b, &BinData::sumw);
+	  sum.sumw2 = orderedSum(b, &BinData::sumw2);
+	  sum.sumxw = orderedSum(b, &BinData::sumxw);
+	  sum.sumx2w = orderedSum(b, &BinData::sumx2w);
+	  sum.sumyw = orderedSum(b, &BinData::sumyw);
+	  sum.sumy2w = orderedSum(b, &BinData::sumy2w);
+	  bin[ix][iy] = sum;
+	}
+    }
 
     /** dummy pointer to non-existen annotation. */
     IAnnotation * anno;
@@ -13,7 +13,11 @@
 //
 
 #include "AIManagedObject.h"
+#include "AIAxis.h"
 #include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
 
 namespace LWH {
 
@@ -41,6 +45,139 @@ public:
   virtual bool writeFLAT(std::ostream & os,
 			 std::string path, std::string name) = 0;
 
+  /**
+   * Write out the object to the given stream in the compact binary
+   * format read by Tree::read(). The record starts with a type tag
+   * followed by the \a path and \a name. All sums are written with
+   * full precision so that files from separate runs can be merged
+   * without loss.
+   * @return false if the object cannot be written in binary format.
+   */
+  virtual bool writeBinary(std::ostream &, std::string, std::string) {
+    return false;
+  }
+
+  /** Type tags for the binary format. */
+  enum BinaryTag { histogram1DTag = 1, histogram2DTag = 2,
+		   dataPointSetTag = 3 };
+
+  /**
+   * Prepare the object to be filled concurrently from \a n shards,
+   * typically one per thread. Each shard is filled separately, and
+   * the shards are combined with mergeShards(). Any contents already
+   * in the shards are merged first.
+   */
+  virtual void setShards(int) {}
+
+  /**
+   * Combine the contents of all shards into the object itself and
+   * clear the shards. The result does not depend on which shard was
+   * filled with what, and is reproducible bit by bit.
+   */
+  virtual void mergeShards() {}
+
+  /**
+   * The index of the shard which is filled by the current thread. The
+   * default, 0, means the object itself. A worker thread should set
+   * this to a unique index smaller than the number of shards given
+   * in setShards() before filling anything.
+   */
+  static int & currentShard() {
+    static thread_local int shard = 0;
+    return shard;
+  }
+
+  /**
+   * Write out \a x to the binary stream \a os.
+   */
+  template <typename T>
+  static void binaryOut(std::ostream & os, const T & x) {
+    os.write(reinterpret_cast<const char *>(&x), sizeof(T));
+  }
+
+  /**
+   * Write out the string \a s to the binary stream \a os.
+   */
+  static void binaryOut(std::ostream & os, const std::string & s) {
+    binaryOut(os, int(s.size()));
+    os.write(s.data(), s.size());
+  }
+
+  /**
+   * Read \a x from the binary stream \a is.
+   * @return false if the read failed.
+   */
+  template <typename T>
+  static bool binaryIn(std::istream & is, T & x) {
+    is.read(reinterpret_cast<char *>(&x), sizeof(T));
+    return bool(is);
+  }
+
+  /**
+   * Read the string \a s from the binary stream \a is.
+   * @return false if the read failed.
+   */
+  static bool binaryIn(std::istream & is, std::string & s) {
+    int n = 0;
+    if ( !binaryIn(is, n) || n < 0 ) return false;
+    s.assign(n, ' ');
+    if ( n > 0 ) is.read(&s[0], n);
+    return bool(is);
+  }
+
+  /**
+   * Write out the binning of the axis \a ax to the binary stream \a
+   * os.
+   */
+  static void axisOut(std::ostream & os, const IAxis & ax) {
+    binaryOut(os, char(ax.isFixedBinning()? 1: 0));
+    binaryOut(os, ax.bins());
+    if ( ax.isFixedBinning() ) {
+      binaryOut(os, ax.lowerEdge());
+    } else {
+      for ( int i = 0, N = ax.bins(); i < N; ++i )
+	binaryOut(os, ax.binLowerEdge(i));
+    }
+    binaryOut(os, ax.upperEdge());
+  }
+
+  /**
+   * Read the binning of an axis written by axisOut() from the binary
+   * stream \a is. If the binning is \a fixed, \a edges will contain
+   * the lower and upper edge of the \a nbins bins, otherwise all the
+   * bin edges.
+   * @return false if the read failed.
+   */
+  static bool axisIn(std::istream & is, bool & fixed, int & nbins,
+		     std::vector<double> & edges) {
+    char f = 0;
+    if ( !binaryIn(is, f) || !binaryIn(is, nbins) ) return false;
+    if ( nbins <= 0 || nbins > 100000000 ) return false;
+    fixed = f != 0;
+    edges.resize(fixed? 2: nbins + 1);
+    for ( int i = 0, N = edges.size(); i < N; ++i )
+      if ( !binaryIn(is, edges[i]) ) return false;
+    return true;
+  }
+
+protected:
+
+  /**
+   * Return the sum of the \a member of all objects in \a parts. The
+   * values are added in increasing order, so that the result only
+   * depends on the set of values and not on the order of \a parts.
+   */
+  template <typename T>
+  static double orderedSum(const std::vector<const T *> & parts,
+			   double T::*member) {
+    std::vector<double> v(parts.size());
+    for ( int i = 0, N = parts.size(); i < N; ++i ) v[i] = parts[i]->*member;
+    std::sort(v.begin(), v.end());
+    double sum = 0.0;
+    for ( int i = 0, N = v.size(); i < N; ++i ) sum += v[i];
+    return sum;
+  }
+
 };
 
 }
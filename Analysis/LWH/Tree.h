@@ -14,6 +14,9 @@
 
 #include "AITree.h"
 #include "ManagedObject.h"
+#include "Histogram1D.h"
+#include "Histogram2D.h"
+#include "DataPointSet.h"
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -50,15 +53,18 @@ public:
   /**
    * The standard constructor.
    */
-  Tree(std::string storename, bool xml = true)
-    : name(storename), flat(!xml), cwd("/"), overwrite(true) {
+  Tree(std::string storename, bool xml = true, bool bin = false)
+    : name(storename), flat(!xml), binary(bin), cwd("/"), overwrite(true),
+      nshards(1), sumweights(0.0) {
     dirs.insert(Path());
   }
 
   /**
    * The default constructor.
    */
-  Tree(): name(""), flat(false), cwd("/") {
+  Tree()
+    : name(""), flat(false), binary(false), cwd("/"), nshards(1),
+      sumweights(0.0) {
     dirs.insert(Path());
   }
 
@@ -66,8 +72,9 @@ public:
    * The copy constructor.
    */
   Tree(const Tree & dt)
-    : ITree(dt), name(dt.name), flat(dt.flat), dirs(dt.dirs),
-      objs(dt.objs), cwd(dt.cwd), overwrite(true) {}
+    : ITree(dt), name(dt.name), flat(dt.flat), binary(dt.binary),
+      dirs(dt.dirs), objs(dt.objs), cwd(dt.cwd), overwrite(true),
+      nshards(dt.nshards), sumweights(dt.sumweights) {}
 
   /// Destructor.
   virtual ~Tree() {
@@ -131,6 +138,8 @@ public:
 	    objs.erase(old);
 	  }
 	  objs[fullname] = o;
+	  ManagedObject * mo = dynamic_cast<ManagedObject *>(o);
+	  if ( mo && nshards > 1 ) mo->setShards(nshards);
 	  return true;
 	}
       }
@@ -279,6 +288,8 @@ public:
    * @return false if something went wrong.
    */
   bool commit() {
+    mergeShards();
+    if ( binary ) return commitBinary();
     std::ofstream of(name.c_str());
     if ( !of ) return false;
     if ( !flat ) of
@@ -300,6 +311,157 @@ public:
     return of.good();
   }
 
+  /**
+   * Prepare all objects in the tree, and all objects inserted later,
+   * to be filled concurrently from \a n shards, typically one per
+   * thread. Each thread should set ManagedObject::currentShard() to
+   * a unique number between 0 and \a n - 1 before filling.
+   */
+  void setShards(int n) {
+    nshards = std::max(n, 1);
+    for ( ObjMap::iterator it = objs.begin(); it != objs.end(); ++it ) {
+      ManagedObject * o = dynamic_cast<ManagedObject *>(it->second);
+      if ( o ) o->setShards(nshards);
+    }
+  }
+
+  /**
+   * The number of shards the objects in this tree are prepared for.
+   */
+  int shards() const {
+    return nshards;
+  }
+
+  /**
+   * Merge the shards of all objects in the tree. This is done
+   * automatically before writing out the tree in commit().
+   */
+  void mergeShards() {
+    for ( ObjMap::iterator it = objs.begin(); it != objs.end(); ++it ) {
+      ManagedObject * o = dynamic_cast<ManagedObject *>(it->second);
+      if ( o ) o->mergeShards();
+    }
+  }
+
+  /**
+   * Merge the contents of the given trees, typically obtained from
+   * separate runs, into this one. Objects with the same path are
+   * combined and objects not already in this tree are created. If the
+   * sum of weights of the run is known for all trees (see
+   * setSumOfWeights()), normalized histograms (ie. histograms which
+   * have been normalize()d or scale()d) are averaged with the sum of
+   * weights of each tree as weight, otherwise histograms are added. The histograms do not depend on the order of the trees, bit
+   * by bit. The points of data point sets are appended in the order
+   * of the trees.
+   * @return false if two objects with the same path could not be
+   * combined.
+   */
+  bool merge(const std::vector<const Tree *> & trees) {
+    bool weighted = !trees.empty();
+    std::vector<double> sw(1, sumweights);
+    for ( int i = 0, N = trees.size(); i < N; ++i ) {
+      weighted = weighted && trees[i]->sumweights > 0.0;
+      sw.push_back(trees[i]->sumweights);
+    }
+    std::sort(sw.begin(), sw.end());
+    double total = 0.0;
+    for ( int i = 0, N = sw.size(); i < N; ++i ) total += sw[i];
+
+    typedef std::map<std::string, std::vector<int> > PartMap;
+    PartMap parts;
+    for ( int i = 0, N = trees.size(); i < N; ++i ) {
+      dirs.insert(trees[i]->dirs.begin(), trees[i]->dirs.end());
+      for ( ObjMap::const_iterator it = trees[i]->objs.begin();
+	    it != trees[i]->objs.end(); ++it )
+	parts[it->first].push_back(i);
+    }
+    bool ok = true;
+    for ( PartMap::iterator it = parts.begin(); it != parts.end(); ++it ) {
+      std::vector<const IManagedObject *> ps;
+      std::vector<double> fac;
+      for ( int j = 0, M = it->second.size(); j < M; ++j ) {
+	const Tree & t = *trees[it->second[j]];
+	ps.push_back(t.objs.find(it->first)->second);
+	fac.push_back(weighted? t.sumweights/total: 1.0);
+      }
+      IManagedObject * o = find(it->first);
+      bool created = !o;
+      if ( !mergeObject(o, ps, fac, weighted? sumweights/total: 1.0,
+			weighted) ) ok = false;
+      else if ( created ) {
+	objs[it->first] = o;
+	ManagedObject * mo = dynamic_cast<ManagedObject *>(o);
+	if ( mo && nshards > 1 ) mo->setShards(nshards);
+      }
+    }
+    if ( weighted ) sumweights = total;
+    return ok;
+  }
+
+  /**
+   * Set the sum of the weights of the events in the run which filled
+   * this tree. This is written to the binary format and is used to
+   * weight the tree when merging it with others.
+   */
+  void setSumOfWeights(double sw) {
+    sumweights = sw;
+  }
+
+  /**
+   * The sum of the weights of the events in the run which filled this
+   * tree, or zero if not known.
+   */
+  double sumOfWeights() const {
+    return sumweights;
+  }
+
+  /**
+   * Read in all objects from the binary file \a filename, which was
+   * written by commit() from a tree with binary storage. The objects
+   * are added to this tree, replacing objects with the same path.
+   * @return false if the file could not be read.
+   */
+  bool read(std::string filename) {
+    std::ifstream is(filename.c_str(), std::ios::in | std::ios::binary);
+    if ( !is ) return false;
+    std::string magic(4, ' ');
+    int version = 0;
+    int order = 0;
+    is.read(&magic[0], 4);
+    if ( !is || magic != "LWHB" ||
+	 !ManagedObject::binaryIn(is, version) || version != 1 ||
+	 !ManagedObject::binaryIn(is, order) || order != 0x01020304 ||
+	 !ManagedObject::binaryIn(is, sumweights) ) return false;
+    int tag = 0;
+    while ( ManagedObject::binaryIn(is, tag) ) {
+      std::string path;
+      std::string name;
+      if ( !ManagedObject::binaryIn(is, path) ||
+	   !ManagedObject::binaryIn(is, name) ) return false;
+      IManagedObject * o = 0;
+      switch ( tag ) {
+      case ManagedObject::histogram1DTag:
+	o = Histogram1D::readBinary(is);
+	break;
+      case ManagedObject::histogram2DTag:
+	o = Histogram2D::readBinary(is);
+	break;
+      case ManagedObject::dataPointSetTag:
+	o = DataPointSet::readBinary(is);
+	break;
+      }
+      if ( !o ) return false;
+      mkdirs(purgepath(str2pth(path)));
+      std::string fullname = path + "/" + name;
+      ObjMap::iterator old = objs.find(fullname);
+      if ( old != objs.end() ) delete old->second;
+      objs[fullname] = o;
+      ManagedObject * mo = dynamic_cast<ManagedObject *>(o);
+      if ( mo && nshards > 1 ) mo->setShards(nshards);
+    }
+    return is.eof();
+  }
+
   /**
    * Not implemented in LWH.
    */
@@ -356,6 +518,107 @@ public:
 
 protected:
 
+  /**
+   * Write all objects to the current filename in the binary format.
+   * @return false if something went wrong.
+   */
+  bool commitBinary() {
+    std::ofstream of(name.c_str(), std::ios::out | std::ios::binary);
+    if ( !of ) return false;
+    of.write("LWHB", 4);
+    ManagedObject::binaryOut(of, int(1));
+    ManagedObject::binaryOut(of, int(0x01020304));
+    ManagedObject::binaryOut(of, sumweights);
+    for ( ObjMap::const_iterator it = objs.begin(); it != objs.end(); ++it ) {
+      ManagedObject * o = dynamic_cast<ManagedObject *>(it->second);
+      if ( !o ) continue;
+      std::string path = it->first.substr(0, it->first.rfind('/'));
+      std::string name = it->first.substr(it->first.rfind('/') + 1);
+      o->writeBinary(of, path, name);
+    }
+    return of.good();
+  }
+
+  /**
+   * Add the contents of all objects in \a parts to \a o. If \a o is
+   * null a new empty object of the same type as the parts is created
+   * first. If \a weighted, normalized histograms are averaged, where
+   * \a fac are the weights of the \a parts and \a ofac the weight of
+   * \a o.
+   */
+  static bool mergeObject(IManagedObject *& o,
+			  const std::vector<const IManagedObject *> & parts,
+			  const std::vector<double> & fac, double ofac,
+			  bool weighted) {
+    if ( parts.empty() ) return true;
+    if ( dynamic_cast<const Histogram1D *>(parts[0]) )
+      return mergeHistograms<Histogram1D>(o, parts, fac, ofac, weighted);
+    if ( dynamic_cast<const Histogram2D *>(parts[0]) )
+      return mergeHistograms<Histogram2D>(o, parts, fac, ofac, weighted);
+    if ( dynamic_cast<const DataPointSet *>(parts[0]) ) {
+      std::vector<const DataPointSet *> ds;
+      if ( !castParts(parts, ds) ) return false;
+      if ( !o ) {
+	DataPointSet * d = new DataPointSet(ds[0]->dimension());
+	d->setTitle(ds[0]->title());
+	o = d;
+      }
+      DataPointSet * d = dynamic_cast<DataPointSet *>(o);
+      return d && d->add(ds);
+    }
+    return false;
+  }
+
+  /**
+   * Helper function for mergeObject() for histograms of type H.
+   */
+  template <typename H>
+  static bool mergeHistograms(IManagedObject *& o,
+			      const std::vector<const IManagedObject *> & parts,
+			      const std::vector<double> & fac, double ofac,
+			      bool weighted) {
+    std::vector<const H *> hs;
+    if ( !castParts(parts, hs) ) return false;
+    bool created = !o;
+    if ( created ) {
+      H * h = new H(*hs[0]);
+      h->reset();
+      o = h;
+    }
+    H * h = dynamic_cast<H *>(o);
+    if ( !h ) return false;
+    bool average = weighted && ( created || h->normalized );
+    for ( int i = 0, N = hs.size(); i < N; ++i )
+      average = average && hs[i]->normalized;
+    if ( !average ) return h->add(hs);
+    std::vector<const H *> scaled;
+    for ( int i = 0, N = hs.size(); i < N; ++i ) {
+      H * s = new H(*hs[i]);
+      s->scale(fac[i]);
+      scaled.push_back(s);
+    }
+    h->scale(ofac);
+    bool ok = h->add(scaled);
+    h->normalized = true;
+    for ( int i = 0, N = scaled.size(); i < N; ++i ) delete scaled[i];
+    return ok;
+  }
+
+  /**
+   * Cast all objects in \a parts to type T and put them in \a ts.
+   * @return false if any of the objects was not of type T.
+   */
+  template <typename T>
+  static bool castParts(const std::vector<const IManagedObject *> & parts,
+			std::vector<const T *> & ts) {
+    for ( int i = 0, N = parts.size(); i < N; ++i ) {
+      const T * t = dynamic_cast<const T *>(parts[i]);
+      if ( !t ) return false;
+      ts.push_back(t);
+    }
+    return true;
+  }
+
   /** Strip trailing slash. */
   std::string sts(std::string s) const {
     if ( s[s.length() - 1] == '/' ) s = s.substr(0, s.length() - 1);
@@ -415,6 +678,9 @@ private:
   /** If true write histograms in FLAT format, otherwise in XML. */
   bool flat;
 
+  /** If true write histograms in the binary format. */
+  bool binary;
+
   /** The set of defined directories. */
   PathSet dirs;
 
@@ -427,6 +693,12 @@ private:
   /** Overwrite strategy. */
   bool overwrite;
 
+  /** The number of shards the objects are prepared for. */
+  int nshards;
+
+  /** The sum of weights of the run which filled this tree. */
+  double sumweights;
+
 };
 
 }
@@ -56,24 +56,36 @@ public:
 
   /**
    * Creates a new Tree and associates it with a store.
-   * The store is assumed to be write-only.
-   * The store will be created.
+   * The store is assumed to be write-only, except for the binary
+   * format where an existing store can be read in.
    * @param storeName The name of the store, if empty (""), the tree is
    *                  created in memory and therefore will not be associated
    *                  with a file.
-   * @param storeType must be "xml".
-   * @param readOnly  must be false since we cannot read in trees.
-   * @param createNew must be true indicating that the file will be created
+   * @param storeType must be "xml", "flat" or "binary".
+   * @param readOnly  must be false unless the store type is "binary".
+   * @param createNew must be true indicating that the file will be
+   *                  created, unless an existing binary store should be
+   *                  read in.
    */
   ITree * create(const std::string & storeName,
 		 const std::string & storeType = "",
 		 bool readOnly = false, bool createNew = false,
 		 const std::string & = "") {
-    if ( storeType != "xml" && storeType != "" && storeType != "flat" )
-      throw std::runtime_error("Can only store trees in xml or flat format.");
+    if ( storeType != "xml" && storeType != "" && storeType != "flat" &&
+	 storeType != "binary" )
+      throw std::runtime_error("Can only store trees in xml, flat or "
+			       "binary format.");
+    if ( storeType == "binary" && !createNew ) {
+      Tree * tree = new Tree(storeName, false, true);
+      if ( !tree->read(storeName) ) {
+	delete tree;
+	throw std::runtime_error("Could not read tree from " + storeName + ".");
+      }
+      return tree;
+    }
     if ( readOnly || !createNew )
-      throw std::runtime_error("Cannot read in trees.");
-    return new Tree(storeName, storeType != "flat");
+      throw std::runtime_error("Can only read in trees in binary format.");
+    return new Tree(storeName, storeType != "flat", storeType == "binary");
   }
 
 private:
@@ -16,7 +16,7 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
-#include <map>
+#include <vector>
 #include "AIAxis.h"
 
 namespace LWH {
@@ -35,10 +35,10 @@ public:
   /**
    * Standard constructor.
    */
-  VariAxis(const std::vector<double> & edges) {
-    for ( int i = 0, N = edges.size(); i < N; ++i ) binco[edges[i]] = 0;
-    std::map<double,int>::iterator it = binco.begin();
-    for ( int i = 0, N = edges.size(); i < N; ++i ) (it++)->second = i;
+  VariAxis(const std::vector<double> & edges)
+    : binco(edges) {
+    std::sort(binco.begin(), binco.end());
+    binco.erase(std::unique(binco.begin(), binco.end()), binco.end());
   }
 
   /**
@@ -64,7 +64,7 @@ public:
    *
    */
   double lowerEdge() const {
-    if ( binco.size() ) return binco.begin()->first;
+    if ( binco.size() ) return binco.front();
     return 0;
   }
 
@@ -75,8 +75,7 @@ public:
    */
   double upperEdge() const {
     if ( !binco.size() ) return 0;
-    std::map<double,int>::const_iterator last = binco.end();
-    return (--last)->first;
+    return binco.back();
   }
 
   /** 
@@ -86,6 +85,11 @@ public:
    */
   int bins() const { return binco.size() - 1; }
 
+  /**
+   * The sorted bin edges of the axis.
+   */
+  const std::vector<double> & edges() const { return binco; }
+
   /**
    * Get the lower edge of the specified bin.
    * @param index The bin number: 0 to bins()-1 for the in-range bins
@@ -97,13 +101,11 @@ public:
   std::pair<double,double> binEdges(int index) const {
     std::pair<double,double> edges(0.0, 0.0);
     if ( !binco.size() ) return edges;
-    std::map<double,int>::const_iterator lo = binco.end();
-    std::map<double,int>::const_iterator up = binco.begin();
-    if ( index >= 0 ) while ( index-- >= 0 && up != binco.end() ) lo = up++;
-    edges.first = ( lo == binco.end() )? -std::numeric_limits<double>::max():
-                                         lo->first;
-    edges.second = ( up == binco.end() )? std::numeric_limits<double>::max():
-                                         up->first;
+    const int nb = bins();
+    edges.first = ( index < 0 )? -std::numeric_limits<double>::max():
+                                 binco[std::min(index, nb)];
+    edges.second = ( index >= nb )? std::numeric_limits<double>::max():
+                                    binco[std::max(index, -1) + 1];
     return edges;
   }
 
@@ -153,10 +155,19 @@ public:
    *
    */
   int coordToIndex(double coord) const {
-    std::map<double,int>::const_iterator up = binco.upper_bound(coord);
-    if ( up == binco.begin() ) return UNDERFLOW_BIN;
-    else if ( up == binco.end() ) return OVERFLOW_BIN;
-    else return up->second - 1;
+    if ( binco.empty() ) return UNDERFLOW_BIN;
+    int up = upperBound(coord);
+    if ( up == 0 ) return UNDERFLOW_BIN;
+    else if ( up == int(binco.size()) ) return OVERFLOW_BIN;
+    else return up - 1;
+  }
+
+  /**
+   * Convert \a n coordinates in \a coord to bin numbers in \a index
+   * in the same way as coordToIndex(double).
+   */
+  void coordToIndex(const double * coord, int * index, int n) const {
+    for ( int i = 0; i < n; ++i ) index[i] = coordToIndex(coord[i]);
   }
 
   /**
@@ -171,10 +182,30 @@ public:
 private:
 
   /**
-   * A map relating the lower edge of a bin to the corresponding bin
-   * number.
+   * Return the index of the first bin edge which is larger than \a
+   * coord, or the number of edges if there is none. The search is a
+   * binary search where the loop only depends on the number of
+   * edges, so that the comparison can be compiled into a conditional
+   * move rather than a hard-to-predict branch. There must be at
+   * least one edge.
+   */
+  int upperBound(double coord) const {
+    const double * base = &binco[0];
+    std::size_t n = binco.size();
+    while ( n > 1 ) {
+      const std::size_t half = n/2;
+      base = ( coord < base[half] )? base: base + half;
+      n -= half;
+    }
+    return (base - &binco[0]) + ( coord < *base? 0: 1 );
+  }
+
+private:
+
+  /**
+   * The sorted bin edges.
    */
-  std::map<double,int> binco;
+  std::vector<double> binco;
 
 };
 
@@ -30,6 +30,28 @@ void LWHFactory::doinitrun() {
   FactoryBase::doinitrun();
 }
 
+void LWHFactory::dofinish() {
+  mergeShards();
+  LWH::Tree * t = dynamic_cast<LWH::Tree *>(&tree());
+  if ( t ) t->setSumOfWeights(generator()->sumWeights());
+  FactoryBase::dofinish();
+}
+
+void LWHFactory::setShards(int n) {
+  initrun();
+  LWH::Tree * t = dynamic_cast<LWH::Tree *>(&tree());
+  if ( t ) t->setShards(n);
+}
+
+void LWHFactory::mergeShards() {
+  LWH::Tree * t = dynamic_cast<LWH::Tree *>(&tree());
+  if ( t ) t->mergeShards();
+}
+
+void LWHFactory::currentShard(int i) {
+  LWH::ManagedObject::currentShard() = i;
+}
+
 void LWHFactory::normalizeToXSec(tH1DPtr histogram, CrossSection unit) const {
   LWH::Histogram1D * h = dynamic_cast<LWH::Histogram1D *>(histogram);
   if ( h )
@@ -80,7 +102,11 @@ void LWHFactory::Init() {
      "specifications. Currently the only thing that is supported is "
      "simple, equally binned, one dimensional histograms. If you are "
      "using AnalysisHandlers which accesses other features in the AIDA "
-     "interface you may end up with an ungraceful crash.");
+     "interface you may end up with an ungraceful crash. Besides the "
+     "xml and flat store types, the histograms can be written in a "
+     "compact binary format (<code>set StoreType binary</code>), where "
+     "files from separate runs can be combined with "
+     "<code>mergeLWH</code>.");
 
 }
 
@@ -82,6 +82,32 @@ public:
   virtual void normalizeToUnity(tH2DPtr histogram) const;
   //@}
 
+  /** @name Filling histograms from several threads. */
+  //@{
+  /**
+   * Prepare all histograms and data point sets, including the ones
+   * booked later, to be filled from \a n threads. Each thread fills
+   * its own shard of every object. The shards of a histogram are
+   * merged whenever its contents are read, e.g. when it is
+   * normalized, and the shards of all objects are merged in
+   * dofinish(). The merged result does not depend on which thread
+   * filled what.
+   */
+  void setShards(int n);
+
+  /**
+   * Merge the shards of all histograms and data point sets. This must
+   * only be called when no thread is filling.
+   */
+  void mergeShards();
+
+  /**
+   * Select the shard, 0 to \a n - 1, to be filled by the calling
+   * thread, where \a n was given in setShards().
+   */
+  static void currentShard(int i);
+  //@}
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -136,6 +162,12 @@ protected:
    * a run begins.
    */
   virtual void doinitrun();
+
+  /**
+   * Finalize this object. Called in the run phase just after a
+   * run has ended. Used eg. to write out statistics.
+   */
+  virtual void dofinish();
   //@}
 
 
@@ -90,7 +90,7 @@ HepMC::GenEvent * NLOHepMCFile::makeEvent(tEventPtr event, tSubProPtr sub, long
 
   HepMC::GenEvent * ev = 
     HepMCTraits<HepMC::GenEvent>::newEvent(no,event->weight()*sub->groupWeight(),
-					   event->optionalWeights());
+					   generator()->eventHandler()->optionalWeights(*event));
   HepMCTraits<HepMC::GenEvent>::setUnits(*ev,eUnit,lUnit);
   HepMCTraits<HepMC::GenEvent>::setBeamParticles(*ev,b1,b2);
 
@@ -129,8 +129,10 @@ void NLOHepMCFile::analyze(tEventPtr event, long, int, int) {
        _hepmcio->set_run_info(std::make_shared<HepMC::GenRunInfo>());
     std::vector<std::string>  w_names;
     w_names.push_back("Default");
-    for ( map<string,double>::const_iterator w = event->optionalWeights().begin();
-     w != event->optionalWeights().end(); ++w ) {
+    map<string,double> weights =
+      generator()->eventHandler()->optionalWeights(*event);
+    for ( map<string,double>::const_iterator w = weights.begin();
+     w != weights.end(); ++w ) {
      w_names.push_back(w->first);
     }
     _hepmcio->run_info()->set_weight_names(w_names);  
@@ -77,7 +77,7 @@ HepMC::GenEvent * makeEvent(tEventPtr event, tSubProPtr sub, long no, long remna
 
   HepMC::GenEvent * ev = 
     HepMCTraits<HepMC::GenEvent>::newEvent(no,event->weight()*sub->groupWeight(),
-					   event->optionalWeights());
+					   CurrentGenerator::current().eventHandler()->optionalWeights(*event));
   HepMCTraits<HepMC::GenEvent>::setUnits(*ev,eUnit,lUnit);
   HepMCTraits<HepMC::GenEvent>::setBeamParticles(*ev,b1,b2);
 
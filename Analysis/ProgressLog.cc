@@ -7,20 +7,64 @@
 #include "ProgressLog.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Interface/Switch.h"
 #include "ThePEG/EventRecord/Particle.h"
 #include "ThePEG/Repository/UseRandom.h"
 #include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Handlers/StandardEventHandler.h"
+#include "ThePEG/Handlers/StandardXComb.h"
+#include "ThePEG/MatrixElement/MEBase.h"
 
 
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
 
 #include <sys/times.h>
+#include <sys/resource.h>
 #include <unistd.h>
+#include <chrono>
+#include <cstdio>
 
 using namespace ThePEG;
 
-ProgressLog::ProgressLog(): secstep(0) {}
+namespace {
+
+/**
+ * Return the string \a s quoted for use inside a JSON string.
+ */
+string jsonEscape(const string & s) {
+  string ret;
+  for ( string::size_type i = 0; i < s.length(); ++i ) {
+    unsigned char c = s[i];
+    if ( c == '"' || c == '\\' ) ret += '\\';
+    if ( c >= 0x20 ) {
+      ret += c;
+      continue;
+    }
+    char buf[8];
+    std::snprintf(buf, sizeof(buf), "\\u%04x", int(c));
+    ret += buf;
+  }
+  return ret;
+}
+
+/**
+ * Return the string \a s quoted for use as a Prometheus label value.
+ */
+string labelEscape(const string & s) {
+  string ret;
+  for ( string::size_type i = 0; i < s.length(); ++i ) {
+    if ( s[i] == '"' || s[i] == '\\' ) ret += '\\';
+    if ( s[i] == '\n' ) ret += "\\n";
+    else ret += s[i];
+  }
+  return ret;
+}
+
+}
+
+ProgressLog::ProgressLog()
+  : secstep(0), metricsFormat(0), wall0(0.0), wall1(0.0), ieve1(0) {}
 
 ProgressLog::~ProgressLog() {}
 
@@ -80,9 +124,104 @@ void ProgressLog::analyze(tEventPtr event, long ieve, int loop, int state) {
     
   fcpu1 = fcpui;
   time1 = timei;
+
+  if ( metricsFormat ) writeMetrics(i, n);
   
 }
 
+string ProgressLog::metricsFileName() const {
+  if ( !metricsFile.empty() ) return metricsFile;
+  return generator()->filename() +
+    ( metricsFormat == 2? "-metrics.prom": "-metrics.jsonl" );
+}
+
+void ProgressLog::writeMetrics(long i, long n) {
+  double walli = fwallclock();
+  double elapsed = walli - wall0;
+  double rate = elapsed > 0.0? double(i)/elapsed: 0.0;
+  double current = walli > wall1? double(i - ieve1)/(walli - wall1): rate;
+  wall1 = walli;
+  ieve1 = i;
+  double xsec = generator()->eventHandler()->integratedXSec()/nanobarn;
+  double xsecerr = generator()->eventHandler()->integratedXSecErr()/nanobarn;
+  long rss = residentMemory();
+  string run = generator()->runName();
+  tcStdEHPtr eh = dynamic_ptr_cast<tcStdEHPtr>(generator()->eventHandler());
+
+  if ( metricsFormat == 1 ) {
+    ofstream os(metricsFileName().c_str(), ios::app);
+    os << "{\"time\": " << time(0) << ", \"run\": \"" << jsonEscape(run)
+       << "\", \"host\": \"" << jsonEscape(host) << "\", \"pid\": " << pid
+       << ", \"event\": " << i << ", \"events\": " << n
+       << ", \"wall\": " << elapsed << ", \"cpu\": " << fclock() - fcpu0
+       << ", \"rate\": " << rate << ", \"currentRate\": " << current
+       << ", \"xsec\": " << xsec << ", \"xsecErr\": " << xsecerr
+       << ", \"rss\": " << rss << ", \"xcombs\": [";
+    bool first = true;
+    if ( eh ) for ( int ix = 0, N = eh->xCombs().size(); ix < N; ++ix ) {
+      const XSecStat & stats = eh->xCombs()[ix]->stats();
+      if ( stats.attempts() <= 0.0 ) continue;
+      os << ( first? "": ", " ) << "{\"id\": " << ix << ", \"me\": \""
+	 << jsonEscape(eh->xCombs()[ix]->matrixElement()->name())
+	 << "\", \"attempts\": " << long(stats.attempts())
+	 << ", \"accepted\": " << long(stats.accepted())
+	 << ", \"ratio\": " << stats.accepted()/stats.attempts() << "}";
+      first = false;
+    }
+    os << "]}" << endl;
+  } else {
+    // Write to a temporary file which is then renamed, so that the
+    // file is never seen half written by a collector.
+    string file = metricsFileName();
+    string tmp = file + ".tmp";
+    {
+      ofstream os(tmp.c_str());
+      run = labelEscape(run);
+      string lbl = "{run=\"" + run + "\"}";
+      os << "# HELP thepeg_events_total Number of events processed.\n"
+	 << "# TYPE thepeg_events_total counter\n"
+	 << "thepeg_events_total" << lbl << " " << i << "\n"
+	 << "# HELP thepeg_events_requested Number of events requested.\n"
+	 << "# TYPE thepeg_events_requested gauge\n"
+	 << "thepeg_events_requested" << lbl << " " << n << "\n"
+	 << "# HELP thepeg_events_per_second Events per second since the "
+	 << "start of the run and since the previous record.\n"
+	 << "# TYPE thepeg_events_per_second gauge\n"
+	 << "thepeg_events_per_second{run=\"" << run
+	 << "\",window=\"run\"} " << rate << "\n"
+	 << "thepeg_events_per_second{run=\"" << run
+	 << "\",window=\"current\"} " << current << "\n"
+	 << "# HELP thepeg_cross_section_nb Current cross section estimate.\n"
+	 << "# TYPE thepeg_cross_section_nb gauge\n"
+	 << "thepeg_cross_section_nb" << lbl << " " << xsec << "\n"
+	 << "# HELP thepeg_cross_section_error_nb Error on the current "
+	 << "cross section estimate.\n"
+	 << "# TYPE thepeg_cross_section_error_nb gauge\n"
+	 << "thepeg_cross_section_error_nb" << lbl << " " << xsecerr << "\n"
+	 << "# HELP thepeg_resident_memory_bytes Resident memory.\n"
+	 << "# TYPE thepeg_resident_memory_bytes gauge\n"
+	 << "thepeg_resident_memory_bytes" << lbl << " " << rss << "\n"
+	 << "# HELP thepeg_xcomb_attempts_total Attempted events per XComb.\n"
+	 << "# TYPE thepeg_xcomb_attempts_total counter\n";
+      if ( eh ) for ( int ix = 0, N = eh->xCombs().size(); ix < N; ++ix )
+	if ( eh->xCombs()[ix]->stats().attempts() > 0.0 )
+	  os << "thepeg_xcomb_attempts_total{run=\"" << run << "\",xcomb=\"" << ix
+	     << "\",me=\""
+	     << labelEscape(eh->xCombs()[ix]->matrixElement()->name())
+	     << "\"} " << long(eh->xCombs()[ix]->stats().attempts()) << "\n";
+      os << "# HELP thepeg_xcomb_accepted_total Accepted events per XComb.\n"
+	 << "# TYPE thepeg_xcomb_accepted_total counter\n";
+      if ( eh ) for ( int ix = 0, N = eh->xCombs().size(); ix < N; ++ix )
+	if ( eh->xCombs()[ix]->stats().attempts() > 0.0 )
+	  os << "thepeg_xcomb_accepted_total{run=\"" << run << "\",xcomb=\"" << ix
+	     << "\",me=\""
+	     << labelEscape(eh->xCombs()[ix]->matrixElement()->name())
+	     << "\"} " << long(eh->xCombs()[ix]->stats().accepted()) << "\n";
+    }
+    std::rename(tmp.c_str(), file.c_str());
+  }
+}
+
 double ProgressLog::fclock() {
   struct tms tmsbuf;
   times(&tmsbuf);
@@ -92,6 +231,26 @@ double ProgressLog::fclock() {
   return d;
 }
 
+double ProgressLog::fwallclock() {
+  return std::chrono::duration<double>
+    (std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+long ProgressLog::residentMemory() {
+  long pages = 0;
+  long rss = 0;
+  FILE * f = fopen("/proc/self/statm", "r");
+  if ( f ) {
+    if ( fscanf(f, "%ld %ld", &pages, &rss) != 2 ) rss = 0;
+    fclose(f);
+  }
+  if ( rss > 0 ) return rss*sysconf(_SC_PAGESIZE);
+  // Fall back on the maximum resident memory (in kB on linux).
+  struct rusage usage;
+  if ( getrusage(RUSAGE_SELF, &usage) == 0 ) return usage.ru_maxrss*1024L;
+  return 0;
+}
+
 bool ProgressLog::statusTime(long i, long n) const {
   if ( i <= 0 ) return false;
   if ( i == n ) return true;
@@ -128,15 +287,30 @@ void ProgressLog::doinitrun() {
   os.setf(ios::right, ios::adjustfield);
   os << " Initializing...                "
      << host << ":" << pid << endl << flush;
+  wall0 = wall1 = fwallclock();
+  ieve1 = 0;
+  if ( metricsFormat == 1 ) ofstream(metricsFileName().c_str());
+}
+
+void ProgressLog::dofinish() {
+  AnalysisHandler::dofinish();
+  // The event counter has been incremented past the last event.
+  long i = generator()->currentEventNumber() - 1;
+  if ( metricsFormat && i > ieve1 ) writeMetrics(i, generator()->N());
 }
 
 
 void ProgressLog::persistentOutput(PersistentOStream & os) const {
-  os << secstep;
+  os << secstep << metricsFormat << metricsFile;
 }
 
-void ProgressLog::persistentInput(PersistentIStream & is, int) {
+void ProgressLog::persistentInput(PersistentIStream & is, int version) {
   is >> secstep;
+  if ( version >= 1 ) is >> metricsFormat >> metricsFile;
+  else {
+    metricsFormat = 0;
+    metricsFile = "";
+  }
 }
 
 ClassDescription<ProgressLog> ProgressLog::initProgressLog;
@@ -166,6 +340,40 @@ void ProgressLog::Init() {
      true, false, Interface::lowerlim);
   interfaceInterval.setHasDefault(false);
 
+  static Switch<ProgressLog,int> interfaceMetrics
+    ("Metrics",
+     "Each time a status line is written, also write a record with "
+     "machine-readable metrics, such as the number of events per second, "
+     "the current cross section estimate, the resident memory and the "
+     "number of attempted and accepted events per XComb, to the file "
+     "given by <interface>MetricsFile</interface>.",
+     &ProgressLog::metricsFormat, 0, true, false);
+  static SwitchOption interfaceMetricsNo
+    (interfaceMetrics,
+     "No",
+     "Do not write metrics.",
+     0);
+  static SwitchOption interfaceMetricsJSONLines
+    (interfaceMetrics,
+     "JSONLines",
+     "Append each record as a line of JSON to the file.",
+     1);
+  static SwitchOption interfaceMetricsPrometheus
+    (interfaceMetrics,
+     "Prometheus",
+     "Rewrite the file in the Prometheus text exposition format for each "
+     "record, suitable for e.g. the textfile collector of the node "
+     "exporter.",
+     2);
+
+  static Parameter<ProgressLog,string> interfaceMetricsFile
+    ("MetricsFile",
+     "The name of the file to which metrics are written. If empty, the "
+     "file name is given by the run name with the suffix "
+     "<code>-metrics.jsonl</code> or <code>-metrics.prom</code> depending "
+     "on the format selected with <interface>Metrics</interface>.",
+     &ProgressLog::metricsFile, "");
+
 
 }
 
@@ -23,6 +23,15 @@ namespace ThePEG {
  * cpu usage [the usage is given in brackets]), and the host on which
  * the program is running, together with its process number.
  *
+ * Optionally, each time a status line is written, a record of
+ * machine-readable metrics can also be written to a separate file,
+ * either as a line of JSON appended to the file or as a file in the
+ * Prometheus text exposition format which is rewritten each time. The
+ * metrics include the number of events per second, the current
+ * estimate of the cross section, the resident memory of the process
+ * and the number of attempted and accepted events for each XComb
+ * object of the StandardEventHandler.
+ *
  * @see \ref ProgressLogInterfaces "The interfaces"
  * defined for ProgressLog.
  */
@@ -72,11 +81,28 @@ public:
    */
   static double fclock();
 
+  /**
+   * Return the wall clock in seconds.
+   */
+  static double fwallclock();
+
+  /**
+   * Return the resident memory of the current process in bytes, or
+   * zero if it could not be determined.
+   */
+  static long residentMemory();
+
   /**
    * Check if it is time to write out a status line.
    */
   bool statusTime(long i, long n) const;
 
+  /**
+   * Write out a metrics record for the \a i events processed so far
+   * out of \a n requested.
+   */
+  void writeMetrics(long i, long n);
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -131,8 +157,21 @@ protected:
    * a run begins.
    */
   virtual void doinitrun();
+
+  /**
+   * Finalize this object. Called in the run phase just after a
+   * run has ended. Used e.g. to write out statistics.
+   */
+  virtual void dofinish();
   //@}
 
+private:
+
+  /**
+   * The file to which metrics records are written.
+   */
+  string metricsFileName() const;
+
 private:
 
   /**
@@ -170,6 +209,34 @@ private:
    */
   pid_t pid;
 
+  /**
+   * The format of the metrics records: 0 means no metrics, 1 means
+   * JSON lines and 2 means Prometheus text format.
+   */
+  int metricsFormat;
+
+  /**
+   * The name of the file where metrics are written. If empty, the
+   * file name is given by the run name.
+   */
+  string metricsFile;
+
+  /**
+   * The wall clock when the run was started.
+   */
+  double wall0;
+
+  /**
+   * The wall clock the last time a metrics record was written out.
+   */
+  double wall1;
+
+  /**
+   * The number of events processed the last time a metrics record
+   * was written out.
+   */
+  long ieve1;
+
 private:
 
   /**
@@ -217,6 +284,9 @@ struct ClassTraits<ProgressLog>
    * linked in the order they are specified.
    */
   static string library() { return "ProgressLog.so"; }
+  /** Return the class version. Version 1 added the settings for
+   *  writing metrics. */
+  static int version() { return 1; }
 };
 
 /** @endcond */
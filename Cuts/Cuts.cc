@@ -37,7 +37,8 @@ Cuts::Cuts(Energy MhatMin)
     theYHatMin(-Constants::MaxRapidity), theYHatMax(Constants::MaxRapidity),
     theX1Min(0.0), theX1Max(1.0), theX2Min(0.0), theX2Max(1.0),
     theScaleMin(ZERO), theScaleMax(Constants::MaxEnergy2),
-    theSubMirror(false), theCutWeight(1.0), theLastCutWeight(1.0) {}
+    theSubMirror(false), theCutWeight(1.0), theLastCutWeight(1.0),
+    theCutStageCalls(0) {}
 
 Cuts::~Cuts() {}
 
@@ -51,6 +52,7 @@ IBPtr Cuts::fullclone() const {
 
 void Cuts::doinitrun() {
   Interfaced::doinitrun();
+  setupCutStages();
   if ( Debug::level ) {
     describe();
     for_each(theOneCuts,   mem_fn(&OneCutBase::describe));
@@ -114,14 +116,14 @@ bool Cuts::initSubProcess(Energy2 shat, double yhat, bool mirror) const {
 bool Cuts::passCuts(const tcPDVector & ptype, const vector<LorentzMomentum> & p,
 		    tcPDPtr t1, tcPDPtr t2) const {
   if ( subMirror() ) {
-    vector<LorentzMomentum> pmir = p;
-    for ( int i = 0, N = pmir.size(); i < N; ++i ) pmir[i].setZ(-pmir[i].z());
+    theMirrorMomenta.assign(p.begin(), p.end());
+    for ( int i = 0, N = theMirrorMomenta.size(); i < N; ++i )
+      theMirrorMomenta[i].setZ(-theMirrorMomenta[i].z());
     swap(t1,t2);
     HoldFlag<> nomir(theSubMirror, false);
-    return passCuts(ptype, pmir, t1, t2);
+    return passCuts(ptype, theMirrorMomenta, t1, t2);
   }
 
-  bool pass = true;
   theCutWeight = 1.0;
   theLastCutWeight = 1.0;
 
@@ -148,81 +150,120 @@ bool Cuts::passCuts(const tcPDVector & ptype, const vector<LorentzMomentum> & p,
 	}
       }
 
-      if ( jetFinder()->cluster(jettype,jets,this,t1,t2) ){
+      if ( jetFinder()->clusterCached(jettype,jets,this,t1,t2) ){
 	return passCuts(jettype,jets,t1,t2);
       }
     }
 
   }
 
-  for ( int i = 0, N = p.size(); i < N; ++i )
-    for ( int j = 0, M = theOneCuts.size(); j < M; ++j ) {
-      pass &= theOneCuts[j]->passCuts(this, ptype[i], p[i]);
+  if ( theCutStages.size() !=
+       theOneCuts.size() + 3*theTwoCuts.size() + theMultiCuts.size() )
+    setupCutStages();
+
+  // Every now and then, move the stages which have rejected the most
+  // points per call to a cut object to the front. The stable sort
+  // keeps the order reproducible.
+  if ( ++theCutStageCalls >= 1000 ) {
+    theCutStageCalls = 0;
+    stable_sort(theCutStages.begin(), theCutStages.end(),
+		[](const CutStage & a, const CutStage & b) {
+		  return a.efficiency() > b.efficiency();
+		});
+  }
+
+  for ( int is = 0, NS = theCutStages.size(); is < NS; ++is )
+    if ( !passCutStage(theCutStages[is], ptype, p, t1, t2) ) {
+      ++theCutStages[is].rejects;
+      theCutWeight = 0.0;
+      return false;
+    }
+
+  return true;
+
+}
+
+void Cuts::setupCutStages() const {
+  theCutStages.clear();
+  theCutStageCalls = 0;
+  for ( int j = 0, M = theOneCuts.size(); j < M; ++j )
+    theCutStages.push_back(CutStage(CutStage::oneCut, j));
+  for ( int j = 0, M = theTwoCuts.size(); j < M; ++j )
+    theCutStages.push_back(CutStage(CutStage::twoCut, j));
+  for ( int j = 0, M = theMultiCuts.size(); j < M; ++j )
+    theCutStages.push_back(CutStage(CutStage::multiCut, j));
+  for ( int j = 0, M = theTwoCuts.size(); j < M; ++j )
+    theCutStages.push_back(CutStage(CutStage::firstCut, j));
+  for ( int j = 0, M = theTwoCuts.size(); j < M; ++j )
+    theCutStages.push_back(CutStage(CutStage::secondCut, j));
+}
+
+bool Cuts::passCutStage(CutStage & stage, const tcPDVector & ptype,
+			const vector<LorentzMomentum> & p,
+			tcPDPtr t1, tcPDPtr t2) const {
+  bool pass = true;
+  switch ( stage.kind ) {
+  case CutStage::oneCut: {
+    tOneCutPtr cut = theOneCuts[stage.index];
+    for ( int i = 0, N = p.size(); i < N; ++i ) {
+      ++stage.calls;
+      pass &= cut->passCuts(this, ptype[i], p[i]);
       theCutWeight *= theLastCutWeight;
       theLastCutWeight = 1.0;
-      if ( !pass ) {
-	theCutWeight = 0.0;
-	return false;
-      }
+      if ( !pass ) return false;
     }
-
-  for ( int i1 = 0, N1 = p.size() - 1; i1 < N1; ++i1 )
-    for ( int i2 = i1 + 1, N2 = p.size(); i2 < N2; ++i2 )
-      for ( int j = 0, M = theTwoCuts.size(); j < M; ++j ) {
-	pass &= theTwoCuts[j]->passCuts(this, ptype[i1], ptype[i2],
-					p[i1], p[i2]);
+    break;
+  }
+  case CutStage::twoCut: {
+    tTwoCutPtr cut = theTwoCuts[stage.index];
+    for ( int i1 = 0, N1 = p.size() - 1; i1 < N1; ++i1 )
+      for ( int i2 = i1 + 1, N2 = p.size(); i2 < N2; ++i2 ) {
+	++stage.calls;
+	pass &= cut->passCuts(this, ptype[i1], ptype[i2], p[i1], p[i2]);
 	theCutWeight *= theLastCutWeight;
 	theLastCutWeight = 1.0;
-	if ( !pass ) {
-	  theCutWeight = 0.0;
-	  return false;
-	}
+	if ( !pass ) return false;
       }
-
-  for ( int j = 0, M = theMultiCuts.size(); j < M; ++j ) {
-    pass &= theMultiCuts[j]->passCuts(this, ptype, p);
+    break;
+  }
+  case CutStage::multiCut: {
+    ++stage.calls;
+    pass &= theMultiCuts[stage.index]->passCuts(this, ptype, p);
     theCutWeight *= theLastCutWeight;
     theLastCutWeight = 1.0;
-    if ( !pass ) {
-      theCutWeight = 0.0;
-      return false;
-    }
+    if ( !pass ) return false;
+    break;
   }
-
-  if ( t1 ) {
+  case CutStage::firstCut: {
+    if ( !t1 ) break;
+    tTwoCutPtr cut = theTwoCuts[stage.index];
     LorentzMomentum p1(ZERO, ZERO, 0.5*sqrt(currentSHat()),
 		       0.5*sqrt(currentSHat()));
-    for ( int i = 0, N = p.size(); i < N; ++i )
-      for ( int j = 0, M = theTwoCuts.size(); j < M; ++j ) {
-	pass &= theTwoCuts[j]->passCuts(this, t1, ptype[i], p1, p[i],
-					true, false);
-	theCutWeight *= theLastCutWeight;
-	theLastCutWeight = 1.0;
-	if ( !pass ) {
-	  theCutWeight = 0.0;
-	  return false;
-	}
-      }
+    for ( int i = 0, N = p.size(); i < N; ++i ) {
+      ++stage.calls;
+      pass &= cut->passCuts(this, t1, ptype[i], p1, p[i], true, false);
+      theCutWeight *= theLastCutWeight;
+      theLastCutWeight = 1.0;
+      if ( !pass ) return false;
+    }
+    break;
   }
-
-  if ( t2 ) {
+  case CutStage::secondCut: {
+    if ( !t2 ) break;
+    tTwoCutPtr cut = theTwoCuts[stage.index];
     LorentzMomentum p2(ZERO, ZERO,
 		       -0.5*sqrt(currentSHat()), 0.5*sqrt(currentSHat()));
-    for ( int i = 0, N = p.size(); i < N; ++i )
-      for ( int j = 0, M = theTwoCuts.size(); j < M; ++j ) {
-	pass &= theTwoCuts[j]->passCuts(this, ptype[i], t2, p[i], p2,
-					false, true);
-	theCutWeight *= theLastCutWeight;
-	theLastCutWeight = 1.0;
-	if ( !pass ) {
-	  theCutWeight = 0.0;
-	  return false;
-	}
-      }
+    for ( int i = 0, N = p.size(); i < N; ++i ) {
+      ++stage.calls;
+      pass &= cut->passCuts(this, ptype[i], t2, p[i], p2, false, true);
+      theCutWeight *= theLastCutWeight;
+      theLastCutWeight = 1.0;
+      if ( !pass ) return false;
+    }
+    break;
+  }
   }
-
   return pass;
-
 }
 
 bool Cuts::passCuts(const tcPVector & p, tcPDPtr t1, tcPDPtr t2) const {
@@ -133,6 +133,11 @@ public:
    * be given in the rest frame of tha hard sub-process, and the
    * initSubProcess must have been called before. Also the types of
    * the incoming partons, \a t1 and \a t2, may be given if availible.
+   *
+   * The individual cut objects are evaluated in an order which is
+   * adjusted during the run, so that the cuts which have rejected
+   * the most phase space points per call are tried first. The
+   * evaluation stops at the first cut which is not passed.
    */
   virtual bool passCuts(const tcPDVector & ptype, const vector<LorentzMomentum> & p,
 			tcPDPtr t1 = tcPDPtr(), tcPDPtr t2 = tcPDPtr()) const;
@@ -339,17 +344,17 @@ public:
   /**
    * Add a OneCutBase object.
    */
-  void add(tOneCutPtr c) { theOneCuts.push_back(c); }
+  void add(tOneCutPtr c) { theOneCuts.push_back(c); theCutStages.clear(); }
 
   /**
    * Add a TwoCutBase object.
    */
-  void add(tTwoCutPtr c) { theTwoCuts.push_back(c); }
+  void add(tTwoCutPtr c) { theTwoCuts.push_back(c); theCutStages.clear(); }
 
   /**
    * Add a MultiCutBase object.
    */
-  void add(tMultiCutPtr c) { theMultiCuts.push_back(c); }
+  void add(tMultiCutPtr c) { theMultiCuts.push_back(c); theCutStages.clear(); }
   //@}
 
 public:
@@ -792,6 +797,90 @@ private:
 
 private:
 
+  /**
+   * Helper struct describing one stage in the evaluation of the cut
+   * objects in passCuts(const tcPDVector &, const vector<LorentzMomentum> &,
+   * tcPDPtr, tcPDPtr), together with statistics of how often the
+   * stage has rejected a phase space point.
+   */
+  struct CutStage {
+
+    /**
+     * The different kinds of stages.
+     */
+    enum Kind {
+      oneCut,      /**< A OneCutBase object applied to all outgoing
+		      particles. */
+      twoCut,      /**< A TwoCutBase object applied to all pairs of
+		      outgoing particles. */
+      multiCut,    /**< A MultiCutBase object applied to all outgoing
+		      particles. */
+      firstCut,    /**< A TwoCutBase object applied to the first
+		      incoming and all outgoing particles. */
+      secondCut    /**< A TwoCutBase object applied to the second
+		      incoming and all outgoing particles. */
+    };
+
+    /** Constructor. */
+    CutStage(Kind k = oneCut, int i = 0)
+      : kind(k), index(i), calls(0.0), rejects(0.0) {}
+
+    /**
+     * The number of rejections per call to an underlying cut object,
+     * where a stage which has not yet been tried is given a high
+     * priority.
+     */
+    double efficiency() const { return (rejects + 1.0)/(calls + 1.0); }
+
+    /** The kind of stage. */
+    Kind kind;
+
+    /** The index of the cut object in the corresponding vector. */
+    int index;
+
+    /** The number of calls made to the underlying cut object. */
+    double calls;
+
+    /** The number of phase space points rejected by this stage. */
+    double rejects;
+
+  };
+
+  /**
+   * Set up the stages used in passCuts(const tcPDVector &, const
+   * vector<LorentzMomentum> &, tcPDPtr, tcPDPtr) in the order the
+   * cut objects were given.
+   */
+  void setupCutStages() const;
+
+  /**
+   * Evaluate the given \a stage for the outgoing particles with types
+   * \a ptype and momenta \a p and the incoming partons \a t1 and \a
+   * t2. Returns false if the point was rejected.
+   */
+  bool passCutStage(CutStage & stage, const tcPDVector & ptype,
+		    const vector<LorentzMomentum> & p,
+		    tcPDPtr t1, tcPDPtr t2) const;
+
+  /**
+   * The stages used in passCuts(const tcPDVector &, const
+   * vector<LorentzMomentum> &, tcPDPtr, tcPDPtr), ordered so that the
+   * most efficient ones are evaluated first.
+   */
+  mutable vector<CutStage> theCutStages;
+
+  /**
+   * The number of calls to passCuts(const tcPDVector &, const
+   * vector<LorentzMomentum> &, tcPDPtr, tcPDPtr) since the stages were
+   * last reordered.
+   */
+  mutable long theCutStageCalls;
+
+  /**
+   * Buffer for momenta mirrored along the z-axis.
+   */
+  mutable vector<LorentzMomentum> theMirrorMomenta;
+
   /**
    * The static object used to initialize the description of this class.
    * Indicates that this is a concrete class with persistent data.
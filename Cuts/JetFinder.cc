@@ -22,6 +22,7 @@
 #include "ThePEG/Repository/UseRandom.h"
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Utilities/DescribeClass.h"
+#include "ThePEG/Cuts/Cuts.h"
 
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
@@ -30,10 +31,36 @@ using namespace ThePEG;
 
 JetFinder::JetFinder() 
   : theMinOutgoing(1), theRestrictConstituents(false),
-    theConstituentRapidityRange(Constants::MaxRapidity,Constants::MaxRapidity) {}
+    theConstituentRapidityRange(Constants::MaxRapidity,Constants::MaxRapidity),
+    theCachedKinematics(ZERO, 0.0), theCachedResult(false) {}
 
 JetFinder::~JetFinder() {}
 
+bool JetFinder::clusterCached(tcPDVector & ptype, vector<LorentzMomentum> & p,
+			      tcCutsPtr parent, tcPDPtr t1, tcPDPtr t2) const {
+  pair<Energy2,double> kin(parent->currentSHat(), parent->currentYHat());
+  if ( parent == theCachedParent && kin == theCachedKinematics &&
+       tcPDPair(t1, t2) == theCachedIncoming &&
+       ptype == theCachedTypes && p == theCachedMomenta ) {
+    if ( theCachedResult ) {
+      ptype = theClusteredTypes;
+      p = theClusteredMomenta;
+    }
+    return theCachedResult;
+  }
+  theCachedParent = parent;
+  theCachedKinematics = kin;
+  theCachedIncoming = tcPDPair(t1, t2);
+  theCachedTypes = ptype;
+  theCachedMomenta = p;
+  theCachedResult = cluster(ptype, p, parent, t1, t2);
+  if ( theCachedResult ) {
+    theClusteredTypes = ptype;
+    theClusteredMomenta = p;
+  }
+  return theCachedResult;
+}
+
 string JetFinder::doYRange(string in) {
   istringstream ins(in);
   double first, second;
@@ -55,6 +55,19 @@ public:
 		       tcCutsPtr parent, tcPDPtr t1 = tcPDPtr(),
 		       tcPDPtr t2 = tcPDPtr()) const = 0;
 
+  /**
+   * Perform jet clustering as in cluster(), but reuse the result of
+   * the previous call if it was made with the same outgoing
+   * particles, incoming partons and parent, and the parent had the
+   * same sub-process kinematics. This is the function used by Cuts,
+   * so that a phase space point which is checked several times, as
+   * is typically the case for the different contributions to an NLO
+   * calculation, is only clustered once.
+   */
+  bool clusterCached(tcPDVector & ptype, vector<LorentzMomentum> & p,
+		     tcCutsPtr parent, tcPDPtr t1 = tcPDPtr(),
+		     tcPDPtr t2 = tcPDPtr()) const;
+
   /**
    * Return the matcher for unresolved partons.
    */
@@ -162,6 +175,47 @@ private:
    */
   pair<double,double> theConstituentRapidityRange;
 
+  /**
+   * The particle types given in the last call to clusterCached().
+   */
+  mutable tcPDVector theCachedTypes;
+
+  /**
+   * The momenta given in the last call to clusterCached().
+   */
+  mutable vector<LorentzMomentum> theCachedMomenta;
+
+  /**
+   * The parent given in the last call to clusterCached().
+   */
+  mutable tcCutsPtr theCachedParent;
+
+  /**
+   * The incoming partons given in the last call to clusterCached().
+   */
+  mutable tcPDPair theCachedIncoming;
+
+  /**
+   * The invariant mass squared and rapidity of the sub-process in the
+   * last call to clusterCached().
+   */
+  mutable pair<Energy2,double> theCachedKinematics;
+
+  /**
+   * The result of the last call to clusterCached().
+   */
+  mutable bool theCachedResult;
+
+  /**
+   * The clustered particle types from the last call to clusterCached().
+   */
+  mutable tcPDVector theClusteredTypes;
+
+  /**
+   * The clustered momenta from the last call to clusterCached().
+   */
+  mutable vector<LorentzMomentum> theClusteredMomenta;
+
   /**
    * The assignment operator is private and must never be called.
    * In fact, it should not even be implemented.
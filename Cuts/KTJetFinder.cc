@@ -0,0 +1,370 @@
+// -*- C++ -*-
+//
+// KTJetFinder.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the KTJetFinder class.
+//
+
+#include "KTJetFinder.h"
+#include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Interface/Switch.h"
+#include "ThePEG/PDT/ParticleData.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Utilities/DescribeClass.h"
+#include "ThePEG/Cuts/Cuts.h"
+
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+
+using namespace ThePEG;
+
+KTJetFinder::KTJetFinder() 
+  : theDCut(ZERO), theConeRadius(0.7), 
+    theVariant(kt), theMode(inclusive),
+    theRecombination(recoE) {}
+
+KTJetFinder::~KTJetFinder() {}
+
+IBPtr KTJetFinder::clone() const {
+  return new_ptr(*this);
+}
+
+IBPtr KTJetFinder::fullclone() const {
+  return new_ptr(*this);
+}
+
+void KTJetFinder::describe() const {
+  generator()->log()
+    << "'" << name() << "' clustering jets from constituents matched by '"
+    << unresolvedMatcher()->name() << "'\n"
+    << "into " << (theMode == inclusive ? "inclusive" : "exclusive")
+    << " jets recombining with the "
+    << (theRecombination == recoPt ? "pt" : "E")
+    << " scheme\n";
+  generator()->log() << "The measure used is ";
+  switch(theVariant) {
+  case 1: generator()->log() << "kt"; break;
+  case 2: generator()->log() << "CA"; break;
+  case 3: generator()->log() << "antiKt"; break;
+  case 4: generator()->log() << "sphericalKt"; break;
+  case 5: generator()->log() << "sphericalCA"; break;
+  case 6: generator()->log() << "sphericalAntiKt"; break;
+  default: assert(false);
+  }
+  generator()->log() << "\n";
+  generator()->log() << "The cone radius is R = "
+		     << theConeRadius << "\n";
+  if ( theMode == exclusive ) {
+    generator()->log() << "The exclusive resolution scale in GeV is D = "
+		       << sqrt(theDCut/GeV2) << "\n";
+  }
+  generator()->log() << flush;
+}
+
+void KTJetFinder::setup(PseudoJet & j) const {
+  double pt2 = sqr(j.px) + sqr(j.py);
+  double p2 = pt2 + sqr(j.pz);
+  j.phi = pt2 > 0.0? atan2(j.py, j.px): 0.0;
+  if ( j.phi < 0.0 ) j.phi += 2.0*Constants::pi;
+  if ( pt2 == 0.0 && j.e == abs(j.pz) ) {
+    // Use a large rapidity for partons along the beam.
+    j.rap = j.pz > 0.0? 1.0e5: -1.0e5;
+  } else {
+    double m2 = max(0.0, sqr(j.e) - p2);
+    j.rap = 0.5*log((pt2 + m2)/sqr(j.e + abs(j.pz)));
+    if ( j.pz > 0.0 ) j.rap = -j.rap;
+  }
+  double pabs = sqrt(p2);
+  if ( pabs > 0.0 ) {
+    j.nx = j.px/pabs;
+    j.ny = j.py/pabs;
+    j.nz = j.pz/pabs;
+  } else {
+    j.nx = j.ny = 0.0;
+    j.nz = 1.0;
+  }
+  double k2 = theVariant < sphericalKt? pt2: sqr(j.e);
+  if ( theVariant == kt || theVariant == sphericalKt ) j.kt2p = k2;
+  else if ( theVariant == CA || theVariant == sphericalCA ) j.kt2p = 1.0;
+  else j.kt2p = k2 > 0.0? 1.0/k2: Constants::MaxDouble;
+}
+
+double KTJetFinder::distance(const PseudoJet & i, const PseudoJet & j) const {
+  if ( theVariant < sphericalKt ) {
+    double dphi = abs(i.phi - j.phi);
+    if ( dphi > Constants::pi ) dphi = 2.0*Constants::pi - dphi;
+    return (sqr(i.rap - j.rap) + sqr(dphi))/sqr(theConeRadius);
+  }
+  double norm = theConeRadius < Constants::pi?
+    1.0 - cos(theConeRadius): 3.0 + cos(theConeRadius);
+  return (1.0 - i.nx*j.nx - i.ny*j.ny - i.nz*j.nz)/norm;
+}
+
+void KTJetFinder::combine(PseudoJet & i, const PseudoJet & j) const {
+  i.index = min(i.index, j.index);
+  double pti = sqrt(sqr(i.px) + sqr(i.py));
+  double ptj = sqrt(sqr(j.px) + sqr(j.py));
+  if ( theRecombination == recoE || pti + ptj <= 0.0 ) {
+    i.px += j.px;
+    i.py += j.py;
+    i.pz += j.pz;
+    i.e += j.e;
+  } else {
+    // Add the transverse momenta and take the transverse momentum
+    // weighted average of the rapidities and azimuth angles.
+    double phij = j.phi;
+    if ( phij - i.phi > Constants::pi ) phij -= 2.0*Constants::pi;
+    else if ( i.phi - phij > Constants::pi ) phij += 2.0*Constants::pi;
+    double pt = pti + ptj;
+    double rap = (pti*i.rap + ptj*j.rap)/pt;
+    double phi = (pti*i.phi + ptj*phij)/pt;
+    i.px = pt*cos(phi);
+    i.py = pt*sin(phi);
+    i.pz = pt*sinh(rap);
+    i.e = pt*cosh(rap);
+  }
+  setup(i);
+}
+
+void KTJetFinder::findNN(vector<PseudoJet> & jets, int i, int n) const {
+  // A geometric distance of one corresponds to the beam distance.
+  jets[i].nndist = 1.0;
+  jets[i].nn = -1;
+  for ( int k = 0; k < n; ++k ) {
+    if ( k == i ) continue;
+    double d = distance(jets[i], jets[k]);
+    if ( d < jets[i].nndist ) {
+      jets[i].nndist = d;
+      jets[i].nn = k;
+    }
+  }
+}
+
+bool KTJetFinder::cluster(tcPDVector & ptype, vector<LorentzMomentum> & p,
+			  tcCutsPtr, tcPDPtr, tcPDPtr) const {
+  if ( ptype.size() <= minOutgoing() ){
+    return false;
+  }
+
+  vector<PseudoJet> jets;
+  tcPDVector ptypeBuffer;
+  vector<LorentzMomentum> pBuffer;
+  for ( int i = 0, N = ptype.size(); i < N; ++i ) {
+    if ( !unresolvedMatcher()->check(*ptype[i]) ) {
+      ptypeBuffer.push_back(ptype[i]);
+      pBuffer.push_back(p[i]);
+      continue;
+    }
+    PseudoJet j;
+    j.px = p[i].x()/GeV;
+    j.py = p[i].y()/GeV;
+    j.pz = p[i].z()/GeV;
+    j.e = p[i].t()/GeV;
+    // The pt scheme, like FastJet's pt_scheme, only works with
+    // massless constituents.
+    if ( theRecombination == recoPt )
+      j.e = sqrt(sqr(j.px) + sqr(j.py) + sqr(j.pz));
+    j.index = i;
+    setup(j);
+    jets.push_back(j);
+  }
+
+  double dcut = 0.0;
+  if ( theVariant != antiKt &&
+       theVariant != sphericalAntiKt ) {
+    dcut = theDCut/GeV2;
+  } else {
+    dcut = theDCut != ZERO ? double(GeV2/theDCut) : 0.0;
+  }
+
+  int n = jets.size();
+  for ( int i = 0; i < n; ++i ) findNN(jets, i, n);
+
+  // Since d_ij = min(kt2p_i, kt2p_j)*dist_ij, the smallest d_ij and
+  // d_iB is always found as kt2p_i times the geometric distance to the
+  // nearest neighbour of i. After each step only the jets which had
+  // one of the removed jets as nearest neighbour need to be updated.
+  vector<PseudoJet> recoJets;
+  vector<int> update;
+  while ( n > 0 ) {
+    int imin = 0;
+    double dmin = jets[0].kt2p*jets[0].nndist;
+    for ( int i = 1; i < n; ++i ) {
+      double d = jets[i].kt2p*jets[i].nndist;
+      if ( d < dmin ) {
+	dmin = d;
+	imin = i;
+      }
+    }
+    if ( theMode == exclusive && dmin > dcut ) break;
+
+    int a = -1;
+    int b = imin;
+    if ( jets[imin].nn < 0 ) {
+      if ( theMode == inclusive ) recoJets.push_back(jets[imin]);
+    } else {
+      a = min(imin, jets[imin].nn);
+      b = max(imin, jets[imin].nn);
+      combine(jets[a], jets[b]);
+    }
+
+    int last = --n;
+    if ( b != last ) jets[b] = jets[last];
+
+    update.clear();
+    for ( int k = 0; k < n; ++k ) {
+      int old = jets[k].nn;
+      if ( k == a || old == a || old == b ) update.push_back(k);
+      else if ( old == last ) jets[k].nn = b;
+    }
+    for ( int iu = 0, NU = update.size(); iu < NU; ++iu )
+      findNN(jets, update[iu], n);
+    if ( a >= 0 ) {
+      for ( int k = 0; k < n; ++k ) {
+	if ( k == a ) continue;
+	double d = distance(jets[k], jets[a]);
+	if ( d < jets[k].nndist ) {
+	  jets[k].nndist = d;
+	  jets[k].nn = a;
+	}
+      }
+    }
+  }
+  if ( theMode == exclusive ) recoJets.assign(jets.begin(), jets.begin() + n);
+
+  if ( recoJets.size() + pBuffer.size() == p.size() ){
+    return false;
+  }
+
+  tcPDVector ptypeNew;
+  vector<LorentzMomentum> pNew;
+  for ( int i = 0, N = recoJets.size(); i < N; ++i ) {
+    ptypeNew.push_back(ptype[recoJets[i].index]);
+    pNew.push_back(LorentzMomentum(recoJets[i].px*GeV, recoJets[i].py*GeV,
+				   recoJets[i].pz*GeV, recoJets[i].e*GeV));
+  }
+  ptypeNew.insert(ptypeNew.end(), ptypeBuffer.begin(), ptypeBuffer.end());
+  pNew.insert(pNew.end(), pBuffer.begin(), pBuffer.end());
+  ptype = ptypeNew;
+  p = pNew;
+  return true;
+}
+
+
+void KTJetFinder::persistentOutput(PersistentOStream & os) const {
+  os << ounit(theDCut,GeV2) << theConeRadius << theVariant << theMode
+     << theRecombination;
+}
+
+void KTJetFinder::persistentInput(PersistentIStream & is, int) {
+  is >> iunit(theDCut,GeV2) >> theConeRadius >> theVariant >> theMode
+     >> theRecombination;
+}
+
+
+// *** Attention *** The following static variable is needed for the type
+// description system in ThePEG. Please check that the template arguments
+// are correct (the class and its base class), and that the constructor
+// arguments are correct (the class name and the name of the dynamically
+// loadable library where the class implementation can be found).
+DescribeClass<KTJetFinder,JetFinder>
+  describeKTJetFinder("ThePEG::KTJetFinder", "KTJetFinder.so");
+
+void KTJetFinder::Init() {
+
+  static ClassDocumentation<KTJetFinder> documentation
+    ("KTJetFinder implements the class of longitudinally invariant and "
+     "spherical generalized kt jet clustering algorithms without depending "
+     "on FastJet. It is meant as a faster alternative to FastJetFinder "
+     "for the small number of partons in a hard sub-process, and has the "
+     "same interfaces.");
+
+
+  static Parameter<KTJetFinder,Energy2> interfaceDCut
+    ("DCut",
+     "The distance cut, when acting exclusively. "
+     "The inverse is taken for the anti-kt algorithm, "
+     "while for the Cambridge/Aachen variant dCut/GeV2 is used.",
+     &KTJetFinder::theDCut, GeV2, 0.0*GeV2, 0.0*GeV2, 0*GeV2,
+     false, false, Interface::lowerlim);
+
+
+  static Parameter<KTJetFinder,double> interfaceConeRadius
+    ("ConeRadius",
+     "The cone radius R used in inclusive mode.",
+     &KTJetFinder::theConeRadius, 0.7, 0.0, 10.0,
+     false, false, Interface::limited);
+
+  static Switch<KTJetFinder,int> interfaceVariant
+    ("Variant",
+     "The variant to use.",
+     &KTJetFinder::theVariant, kt, false, false);
+  static SwitchOption interfaceVariantKt
+    (interfaceVariant,
+     "Kt",
+     "Kt algorithm.",
+     kt);
+  static SwitchOption interfaceVariantCA
+    (interfaceVariant,
+     "CA",
+     "Cambridge/Aachen algorithm.",
+     CA);
+  static SwitchOption interfaceVariantAntiKt
+    (interfaceVariant,
+     "AntiKt",
+     "Anti kt algorithm.",
+     antiKt);
+  static SwitchOption interfaceVariantSphericalKt
+    (interfaceVariant,
+     "SphericalKt",
+     "Spherical kt algorithm.",
+     sphericalKt);
+  static SwitchOption interfaceVariantSphericalCA
+    (interfaceVariant,
+     "SphericalCA",
+     "Spherical Cambridge/Aachen algorithm.",
+     sphericalCA);
+  static SwitchOption interfaceVariantSphericalAntiKt
+    (interfaceVariant,
+     "SphericalAntiKt",
+     "Spherical anti kt algorithm.",
+     sphericalAntiKt);
+
+  static Switch<KTJetFinder,int> interfaceMode
+    ("Mode",
+     "The mode to use.",
+     &KTJetFinder::theMode, inclusive, false, false);
+  static SwitchOption interfaceModeInclusive
+    (interfaceMode,
+     "Inclusive",
+     "Find inclusive jets.",
+     inclusive);
+  static SwitchOption interfaceModeExclusive
+    (interfaceMode,
+     "Exclusive",
+     "Find exclusive jets.",
+     exclusive);
+
+  static Switch<KTJetFinder,int> interfaceRecombination
+    ("RecombinationScheme",
+     "The recombination scheme to use.",
+     &KTJetFinder::theRecombination, recoE, false, false);
+  static SwitchOption interfaceRecombinationPt
+    (interfaceRecombination,
+     "Pt",
+     "Add transverse momenta",
+     recoPt);
+  static SwitchOption interfaceRecombinationE
+    (interfaceRecombination,
+     "E",
+     "Add the four-momenta",
+     recoE);
+
+}
@@ -0,0 +1,243 @@
+// -*- C++ -*-
+//
+// KTJetFinder.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_KTJetFinder_H
+#define THEPEG_KTJetFinder_H
+//
+// This is the declaration of the KTJetFinder class.
+//
+
+#include "ThePEG/Cuts/JetFinder.h"
+
+namespace ThePEG {
+
+/**
+ * KTJetFinder implements the same class of generalized kt jet
+ * clustering algorithms as FastJetFinder, but without depending on
+ * the FastJet library. The clustering uses a nearest-neighbour
+ * bookkeeping where only the partons whose nearest neighbour was
+ * merged need to be updated in each step. For the handful of partons
+ * in a hard sub-process this is considerably faster than setting up
+ * a fastjet::ClusterSequence for every phase space point.
+ *
+ * As for FastJet's pt_scheme, the pt recombination scheme first
+ * makes all constituents massless by setting their energy to the
+ * absolute value of their three-momentum. Jets consisting of a
+ * single massive parton are therefore massless and have the
+ * pseudorapidity of the parton as rapidity.
+ *
+ * The particle type of a jet is taken from the constituent with the
+ * lowest index in the vector given to cluster(). Note that
+ * FastJetFinder instead takes the first constituent in the
+ * clustering history, which may differ when a parton is merged into
+ * an already combined jet.
+ *
+ * @see \ref KTJetFinderInterfaces "The interfaces"
+ * defined for KTJetFinder.
+ */
+class KTJetFinder: public JetFinder {
+
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * The default constructor.
+   */
+  KTJetFinder();
+
+  /**
+   * The destructor.
+   */
+  virtual ~KTJetFinder();
+  //@}
+
+public:
+
+  /**
+   * Perform jet clustering on the given outgoing particles.
+   * Optionally, information on the incoming particles is provided.
+   * Return true, if a clustering has been performed.
+   */
+  virtual bool cluster(tcPDVector & ptype, vector<LorentzMomentum> & p,
+		       tcCutsPtr parent, tcPDPtr t1 = tcPDPtr(),
+		       tcPDPtr t2 = tcPDPtr()) const;
+
+  /**
+   * Describe this jet finder.
+   */
+  virtual void describe() const;
+
+public:
+
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
+  /**
+   * The standard Init function used to initialize the interfaces.
+   * Called exactly once for each class by the class description system
+   * before the main function starts or
+   * when this class is dynamically loaded.
+   */
+  static void Init();
+
+protected:
+
+  /** @name Clone Methods. */
+  //@{
+  /**
+   * Make a simple clone of this object.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr clone() const;
+
+  /** Make a clone of this object, possibly modifying the cloned object
+   * to make it sane.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr fullclone() const;
+  //@}
+
+private:
+
+  /**
+   * Helper struct representing a (pseudo) jet during the clustering.
+   */
+  struct PseudoJet {
+
+    /** The momentum components in units of GeV. */
+    double px, py, pz, e;
+
+    /** The rapidity, or the polar angle cosine for spherical variants. */
+    double rap;
+
+    /** The azimuth angle in [0, 2 pi). */
+    double phi;
+
+    /** The unit vector in the direction of the momentum. */
+    double nx, ny, nz;
+
+    /** The transverse momentum (or energy) to the power 2p. */
+    double kt2p;
+
+    /** The geometric distance to the nearest neighbour. */
+    double nndist;
+
+    /** The index of the nearest neighbour, or -1 for the beam. */
+    int nn;
+
+    /** The lowest index of the original partons in the jet, giving
+     *  the type of the jet. */
+    int index;
+
+  };
+
+  /**
+   * Set up the derived quantities of the pseudo jet \a j with the
+   * given momentum components.
+   */
+  void setup(PseudoJet & j) const;
+
+  /**
+   * Return the geometric distance between two pseudo jets.
+   */
+  double distance(const PseudoJet & i, const PseudoJet & j) const;
+
+  /**
+   * Combine two pseudo jets into \a i according to the recombination
+   * scheme. The index of the combined jet is the lower of the two.
+   */
+  void combine(PseudoJet & i, const PseudoJet & j) const;
+
+  /**
+   * Find the nearest neighbour of the pseudo jet \a i among the
+   * first \a n in \a jets.
+   */
+  void findNN(vector<PseudoJet> & jets, int i, int n) const;
+
+private:
+
+  /**
+   * The resolution cut.
+   */
+  Energy2 theDCut;
+
+  /**
+   * The `cone radius' R.
+   */
+  double theConeRadius;
+
+  /**
+   * The possible variants.
+   */
+  enum variants {
+    kt = 1,
+    CA = 2,
+    antiKt = 3,
+    sphericalKt = 4,
+    sphericalCA = 5,
+    sphericalAntiKt = 6
+  };
+
+  /**
+   * The variant.
+   */
+  int theVariant;
+
+  /**
+   * The possible modes.
+   */
+  enum modes {
+    inclusive = 1,
+    exclusive = 2
+  };
+
+  /**
+   * The mode.
+   */
+  int theMode;
+
+  /**
+   * The possible recombination schemes.
+   */
+  enum recombinations {
+    recoPt = 1,
+    recoE = 2
+  };
+
+  /**
+   * The recombination scheme
+   */
+  int theRecombination;
+
+private:
+
+  /**
+   * The assignment operator is private and must never be called.
+   * In fact, it should not even be implemented.
+   */
+  KTJetFinder & operator=(const KTJetFinder &) = delete;
+
+};
+
+}
+
+#endif /* THEPEG_KTJetFinder_H */
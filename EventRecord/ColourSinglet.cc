@@ -15,9 +15,208 @@
 #include "ThePEG/EventRecord/Particle.h"
 #include "ThePEG/Utilities/UtilityBase.h"
 #include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/EventRecord/ColourBase.h"
+#include <typeinfo>
+#include <cstdint>
 
 using namespace ThePEG;
 
+/**
+ * The LineIndex class keeps, for each colour line, the lists of
+ * coloured and anti-coloured particles connected to it among a given
+ * set, in the order of the set. Particles are marked as used when
+ * taken, and used particles are skipped, so that following all colour
+ * lines in a set of particles only requires linear time. The lines
+ * are kept in a flat open-addressing hash table to avoid allocating
+ * a node for each.
+ */
+class ColourSinglet::LineIndex {
+
+public:
+
+  /**
+   * Build the index from a set of particles.
+   */
+  LineIndex(const tcParticleSet & particles)
+    : theParticles(particles.begin(), particles.end()),
+      isUsed(particles.size(), false), theNLines(0) {
+    // Make room for (typically) one line per particle in a table
+    // which is at most half full.
+    size_t n = 4;
+    theShift = 62;
+    while ( n < 2*particles.size() ) {
+      n *= 2;
+      --theShift;
+    }
+    theSlots.resize(n);
+    theEntries.reserve(2*particles.size());
+    for ( int i = 0, N = theParticles.size(); i < N; ++i ) {
+      const Particle & p = *theParticles[i];
+      if ( !p.coloured() || !p.hasColourInfo() ) continue;
+      const ColourBase & c = *p.colourInfo();
+      if ( typeid(c) == typeid(ColourBase) ) {
+	if ( c.colourLine() ) add(c.colourLine(), false, i);
+	if ( c.antiColourLine() ) add(c.antiColourLine(), true, i);
+	continue;
+      }
+      vector<tcColinePtr> lines = c.colourLines();
+      for ( int j = 0, M = lines.size(); j < M; ++j ) add(lines[j], false, i);
+      lines = c.antiColourLines();
+      for ( int j = 0, M = lines.size(); j < M; ++j ) add(lines[j], true, i);
+    }
+  }
+
+  /**
+   * The number of particles in the index.
+   */
+  int size() const { return theParticles.size(); }
+
+  /**
+   * Return the particle with index \a i.
+   */
+  tcPPtr particle(int i) const { return theParticles[i]; }
+
+  /**
+   * Return true if the particle with index \a i has been used.
+   */
+  bool used(int i) const { return isUsed[i]; }
+
+  /**
+   * Mark the particle with index \a i as used.
+   */
+  void use(int i) { isUsed[i] = true; }
+
+  /**
+   * Return the first unused particle which is (\a anti-)coloured and
+   * connected to the given \a line, and mark it as used. Return null
+   * if there is none.
+   */
+  tcPPtr take(tcColinePtr line, bool anti) {
+    size_t slot = find(line);
+    if ( !theSlots[slot].line ) return tcPPtr();
+    int & head = theSlots[slot].head[anti];
+    while ( head >= 0 && isUsed[theEntries[head].particle] )
+      head = theEntries[head].next;
+    if ( head < 0 ) return tcPPtr();
+    int i = theEntries[head].particle;
+    head = theEntries[head].next;
+    isUsed[i] = true;
+    return theParticles[i];
+  }
+
+private:
+
+  /**
+   * Return the slot in the table for the given \a line, which is
+   * either the one where it is stored or the empty one where it
+   * should be stored.
+   */
+  size_t find(tcColinePtr line) const {
+    const ColourLine * l = line.operator->();
+    size_t mask = theSlots.size() - 1;
+    // Fibonacci hashing, using the high bits of the product since the
+    // low bits of the addresses are the same for most lines.
+    size_t slot = (uint64_t(reinterpret_cast<uintptr_t>(l))*
+		   uint64_t(11400714819323198485ull)) >> theShift;
+    for ( ; theSlots[slot].line && theSlots[slot].line != l;
+	  slot = (slot + 1)&mask );
+    return slot;
+  }
+
+  /**
+   * Add the particle with index \a i to the end of the list of
+   * (\a anti-)coloured particles of the given \a line.
+   */
+  void add(tcColinePtr line, bool anti, int i) {
+    size_t slot = find(line);
+    if ( !theSlots[slot].line ) {
+      if ( 2*(theNLines + 1) > theSlots.size() ) {
+	grow();
+	slot = find(line);
+      }
+      theSlots[slot].line = line.operator->();
+      ++theNLines;
+    }
+    Slot & c = theSlots[slot];
+    int e = theEntries.size();
+    theEntries.push_back(Entry(i));
+    if ( c.tail[anti] >= 0 ) theEntries[c.tail[anti]].next = e;
+    else c.head[anti] = e;
+    c.tail[anti] = e;
+  }
+
+  /**
+   * Double the size of the table.
+   */
+  void grow() {
+    vector<Slot> slots(2*theSlots.size());
+    --theShift;
+    slots.swap(theSlots);
+    for ( size_t i = 0, N = slots.size(); i < N; ++i )
+      if ( slots[i].line ) theSlots[find(slots[i].line)] = slots[i];
+  }
+
+  /**
+   * An entry in a list of particles connected to a colour line.
+   */
+  struct Entry {
+    /** Constructor. */
+    Entry(int i) : particle(i), next(-1) {}
+    /** The index of the particle. */
+    int particle;
+    /** The next entry in the list, or -1 if none. */
+    int next;
+  };
+
+  /**
+   * A slot in the hash table, with a colour line and the first and
+   * last entries of the lists of coloured (index 0) and anti-coloured
+   * (index 1) particles connected to it.
+   */
+  struct Slot {
+    /** Constructor. */
+    Slot() : line(0), head{-1, -1}, tail{-1, -1} {}
+    /** The colour line, or null if the slot is empty. */
+    const ColourLine * line;
+    /** The first unused entry. */
+    int head[2];
+    /** The last entry. */
+    int tail[2];
+  };
+
+  /**
+   * The particles in the order of the original set.
+   */
+  tcPVector theParticles;
+
+  /**
+   * True for particles which have been used.
+   */
+  vector<bool> isUsed;
+
+  /**
+   * The entries of all the lists.
+   */
+  vector<Entry> theEntries;
+
+  /**
+   * The hash table of colour lines.
+   */
+  vector<Slot> theSlots;
+
+  /**
+   * The number of bits to shift the hashed line addresses to get an
+   * index in the table, ie. 64 - log2 of its size.
+   */
+  int theShift;
+
+  /**
+   * The number of lines in the table.
+   */
+  size_t theNLines;
+
+};
+
 LorentzMomentum ColourSinglet::momentum() const {
   return Utilities::sumMomentum(partons().begin(), partons().end());
 }
@@ -32,13 +231,16 @@ tcPDVector ColourSinglet::getTripletData() const {
 
 vector<ColourSinglet> ColourSinglet::getSinglets(tcParticleSet & left) {
   vector<ColourSinglet> ret;
+  LineIndex index(left);
+  left.clear();
 
-  while ( !left.empty() ) {
-    tcPPtr p = *left.begin();
+  for ( int i = 0, N = index.size(); i < N; ++i ) {
+    if ( index.used(i) ) continue;
+    tcPPtr p = index.particle(i);
 
     // First just remove colour singlets.
     if ( !p->coloured() || !p->hasColourInfo() ) {
-      left.erase(left.begin());
+      index.use(i);
       continue;
     }
 
@@ -47,12 +249,24 @@ vector<ColourSinglet> ColourSinglet::getSinglets(tcParticleSet & left) {
     if ( !cl ) cl = p->antiColourLine();
 
     // Get the Colour singlet corresponding to this line.
-    ret.push_back(ColourSinglet(cl, left));
+    ret.push_back(ColourSinglet(cl, index));
 
   }
   return ret;
 }
 
+ColourSinglet::ColourSinglet(tcColinePtr cl, LineIndex & index) {
+
+  // Same as below, but using the index.
+  addPiece();
+  if ( !fill(1, true, cl, index) )
+    fill(1, false, cl, index);
+
+  for ( Index i = 1, N = nPieces(); i <= N; ++i )
+    partons().insert(partons().end(), piece(i).begin(), piece(i).end());
+
+}
+
 ColourSinglet::ColourSinglet(tcColinePtr cl, tcParticleSet & left) {
 
   // Follow colour line forward and add coloured partons to the first
@@ -92,6 +306,29 @@ fill(Index s0, bool forward, tcColinePtr cl, tcParticleSet & left) {
   return false;
 }
 
+bool ColourSinglet::
+fill(Index s0, bool forward, tcColinePtr cl, LineIndex & index) {
+  tcColinePtr first = cl;
+  tcPPtr p;
+  while ( (p = index.take(cl, !forward)) ) {
+    if ( forward ) piece(s0).push_back(p);
+    else piece(s0).push_front(p);
+
+    if ( p->hasColourLine(first, forward) ) return true;
+    if ( !( cl = p->colourLine(forward) ) ) return false;
+  }
+
+  // If we get here we have ended up in a colour source or sink.
+  tColinePair fork = cl->sourceNeighbours(forward);
+  if ( !fork.first || !fork.second )
+    throw ColourSingletException()
+      << "Inconsistent Colour flow." << Exception::eventerror;
+  Junction j = addJunction(s0, forward);
+  fill(j.first, !forward, fork.first, index);
+  fill(j.second, !forward, fork.second, index);
+  return false;
+}
+
 ColourSinglet::Junction ColourSinglet::addJunction(Index s0, bool forward) {
   // Add two new string pieces.
   Index s1 = addPiece();
@@ -142,7 +142,10 @@ public:
   /**
    * Extract colour-singlet strings/clusters of partons from the given
    * set. The set will be empty afterwards if all went well - even
-   * colour-singlet particles will be removed.
+   * colour-singlet particles will be removed. The colour lines are
+   * followed using an index of the particles connected to each line,
+   * built once, so that the time taken is linear in the number of
+   * particles.
    */
   static vector<ColourSinglet> getSinglets(tcParticleSet & left);
 
@@ -226,6 +229,19 @@ public:
 
 private:
 
+  /**
+   * Index of the coloured and anti-coloured particles connected to
+   * each colour line among a set of particles. Defined in
+   * ColourSinglet.cc.
+   */
+  class LineIndex;
+
+  /**
+   * Construct a singlet from an initial colour line, taking the
+   * partons from the given \a index.
+   */
+  ColourSinglet(tcColinePtr cl, LineIndex & index);
+
   /**
    * Fill a string piece. Follow a colour line \a forward in colour
    * removing partons from the \a left set and adding them to the
@@ -235,6 +251,12 @@ private:
    */
   bool fill(Index s0, bool forward, tcColinePtr first, tcParticleSet & left);
 
+  /**
+   * Fill a string piece as above, but taking the partons from the
+   * given \a index rather than from a set.
+   */
+  bool fill(Index s0, bool forward, tcColinePtr first, LineIndex & index);
+
   /**
    * Fill a string piece. When creating a new singlet from an old one
    * which has been split, add the string piece \a i1. If it ends in a
@@ -35,6 +35,8 @@ Event::Event(const Event & e)
     allSteps(e.allSteps), allSubProcesses(e.allSubProcesses),
     allParticles(e.allParticles), theHandler(e.theHandler),
     theNumber(e.theNumber), theWeight(e.theWeight),
+    theOptionalWeights(e.theOptionalWeights),
+    theWeightVector(e.theWeightVector), theWeightMask(e.theWeightMask),
     theParticleNumber(e.theParticleNumber) {}
 
 Event::~Event() {
@@ -50,6 +52,8 @@ Event::~Event() {
   theColourLines.clear();
   theNumber = -1;
   theWeight = 0.0;
+  theWeightVector.clear();
+  theWeightMask.clear();
 }
 
 void Event::setInfo(tcEventBasePtr newHandler, string newName,
@@ -196,6 +200,13 @@ ostream & ThePEG::operator<<(ostream & os, const Event & e) {
       os << w.first << ':' << w.second << ' ';
     os << " ]";
   }
+  if ( ! e.weightVector().empty() ) {
+    os << " [ ";
+    for ( int i = 0, N = e.weightVector().size(); i < N; ++i )
+      if ( e.hasVariationWeight(i) )
+	os << i << ':' << e.weightVector()[i] << ' ';
+    os << " ]";
+  }
   os << endl;
   for ( unsigned int i = 0; i < e.collisions().size(); ++i ) {
     os << string(78, '=') << endl;
@@ -344,14 +355,19 @@ void Event::debugme() const {
 void Event::persistentOutput(PersistentOStream & os) const {
   os << theIncoming << theCollisions << allSteps << allSubProcesses
      << allParticles << theNumber << theWeight << theOptionalWeights 
-     << theParticleNumber;
+     << theParticleNumber << theWeightVector << theWeightMask;
   EventConfig::putHandler(os, theHandler);
 }
 
-void Event::persistentInput(PersistentIStream & is, int) {
+void Event::persistentInput(PersistentIStream & is, int version) {
   is >> theIncoming >> theCollisions >> allSteps >> allSubProcesses
      >> allParticles >> theNumber >> theWeight >> theOptionalWeights
      >> theParticleNumber;
+  if ( version >= 1 ) is >> theWeightVector >> theWeightMask;
+  else {
+    theWeightVector.clear();
+    theWeightMask.clear();
+  }
   EventConfig::getHandler(is, theHandler);
 }
 
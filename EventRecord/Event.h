@@ -225,6 +225,28 @@ public:
    */
   const map<string,double>& optionalWeights() const { return theOptionalWeights; }
 
+  /**
+   * Return the variation weights associated to this event. The names
+   * of the weights are given by the corresponding index in
+   * EventHandler::weightNames(). Variations which were not produced
+   * for this event are zero here and false in weightMask().
+   */
+  const vector<double> & weightVector() const { return theWeightVector; }
+
+  /**
+   * Return true for the entries in weightVector() which have been
+   * set for this event.
+   */
+  const vector<bool> & weightMask() const { return theWeightMask; }
+
+  /**
+   * Return true if the variation weight with index \a i in
+   * weightVector() has been set for this event.
+   */
+  bool hasVariationWeight(size_t i) const {
+    return i < theWeightMask.size() && theWeightMask[i];
+  }
+
   /**
    * Print this Event in Graphviz format on the standard output.
    */
@@ -245,6 +267,25 @@ public:
    */
   map<string,double>& optionalWeights() { return theOptionalWeights; }
 
+  /**
+   * Access the variation weights associated to this event. New
+   * weights should be set with variationWeight(size_t, double).
+   */
+  vector<double> & weightVector() { return theWeightVector; }
+
+  /**
+   * Set the variation weight with index \a i in
+   * EventHandler::weightNames() to \a w.
+   */
+  void variationWeight(size_t i, double w) {
+    if ( i >= theWeightVector.size() ) {
+      theWeightVector.resize(i + 1, 0.0);
+      theWeightMask.resize(i + 1, false);
+    }
+    theWeightVector[i] = w;
+    theWeightMask[i] = true;
+  }
+
   /**
    * Set event info.
    */
@@ -383,6 +424,17 @@ private:
    */
   map<string,double> theOptionalWeights;
 
+  /**
+   * Variation weights indexed as the names in
+   * EventHandler::weightNames().
+   */
+  vector<double> theWeightVector;
+
+  /**
+   * True for the entries in theWeightVector which have been set.
+   */
+  vector<bool> theWeightMask;
+
   /**
    * Counter to keep track of particle numbering.
    */
@@ -444,6 +496,9 @@ template <>
 struct ClassTraits<Event>: public ClassTraitsBase<Event> {
   /** Return a platform-independent class name */
   static string className() { return "ThePEG::Event"; }
+  /** Return the class version. Version 1 added the variation
+   *  weights. */
+  static int version() { return 1; }
   /** Create a Event object. */
   static TPtr create() { return TPtr::Create(Event()); }
 };
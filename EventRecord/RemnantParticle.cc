@@ -71,6 +71,21 @@ bool RemnantParticle::remove(tPPtr oldp) {
   return true;
 }
 
+bool RemnantParticle::
+canRecycle(const Particle & particle, tcPPtr parton) const {
+  return parent.operator->() == &particle && theExtracted.size() == 1 &&
+    theExtracted[0] == parton;
+}
+
+bool RemnantParticle::recycle() {
+  tPPtr parton = theExtracted[0];
+  LorentzMomentum pnew = parent->momentum() - parton->momentum();
+  if ( !remData->decayer().checkExtract(parent, parton, pnew) ) return false;
+  setMomentum(pnew);
+  rescaleMass();
+  return true;
+}
+
 void RemnantParticle::fixColourLines(tPPtr parton) {
   if ( parton->hasColour() ) {
     if ( parton->colourLine() )
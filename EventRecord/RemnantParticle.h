@@ -67,6 +67,21 @@ public:
    */
   bool remove(tPPtr parton);
 
+  /**
+   * Return true if this remnant was constructed from the given \a
+   * particle with \a parton as the only extracted parton, in which
+   * case it may be reused with recycle() when the parton has been
+   * given a new momentum.
+   */
+  bool canRecycle(const Particle & particle, tcPPtr parton) const;
+
+  /**
+   * Modify the momentum to reflect that the extracted parton has been
+   * given a new momentum. Returns false if the extraction is not
+   * kinematically possible, in which case nothing is changed.
+   */
+  bool recycle();
+
   /**
    * Acces the extracted partons.
    */
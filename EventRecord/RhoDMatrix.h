@@ -34,7 +34,7 @@ public:
   /**
    * Default constructor with undefined spin.
    */
-  RhoDMatrix() = default;
+  RhoDMatrix() : _spin(PDT::SpinUnknown), _ispin(0) {}
 
   /**
    * Standard constructor giving the spin as 2s+1. The matrix starts out averaged, 
@@ -44,9 +44,15 @@ public:
   : _spin(inspin), _ispin(abs(int(inspin))) {
     assert(_ispin <= MAXSPIN);
     // initialize to average
-    if ( average )
-        for(size_t ix=0; ix<_ispin; ++ix)
-	    _matrix[ix][ix] = 1./_ispin;
+    if ( average ) {
+      switch ( _ispin ) {
+      case 1: averageN<1>(); break;
+      case 2: averageN<2>(); break;
+      case 3: averageN<3>(); break;
+      case 4: averageN<4>(); break;
+      case 5: averageN<5>(); break;
+      }
+    }
   }
   //@}
 
@@ -76,18 +82,13 @@ public:
    * renormalise the matrix so it has unit trace
    */
   void normalize() {
-#ifndef NDEBUG
-    static const double epsa=1e-40, epsb=1e-10;
-#endif
-    Complex norm = 0.;
-    for(size_t ix=0; ix<_ispin; ++ix) 
-      norm += _matrix[ix][ix];
-    assert(norm.real() > epsa);
-    assert(norm.imag()/norm.real() < epsb);
-    double invnorm = 1./norm.real();
-    for(size_t ix=0; ix<_ispin; ++ix)
-      for(size_t iy=0; iy<_ispin; ++iy) 
-	_matrix[ix][iy]*=invnorm;
+    switch ( _ispin ) {
+    case 1: normalizeN<1>(); break;
+    case 2: normalizeN<2>(); break;
+    case 3: normalizeN<3>(); break;
+    case 4: normalizeN<4>(); break;
+    case 5: normalizeN<5>(); break;
+    }
   }
   //@}
   
@@ -95,12 +96,13 @@ public:
    *  Reset
    */
   void reset(bool average = true) {
-    for(size_t ix=0; ix<_ispin; ++ix)
-      for(size_t iy=0; iy<_ispin; ++iy)
-	_matrix[ix][iy]=0.;
-    if ( average )
-      for(size_t ix=0; ix<_ispin; ++ix)
-	_matrix[ix][ix] = 1./_ispin;
+    switch ( _ispin ) {
+    case 1: resetN<1>(average); break;
+    case 2: resetN<2>(average); break;
+    case 3: resetN<3>(average); break;
+    case 4: resetN<4>(average); break;
+    case 5: resetN<5>(average); break;
+    }
   }
     
   /** @name Access the spin. */
@@ -117,6 +119,53 @@ public:
    */
   friend ostream & operator<<(ostream & os, const RhoDMatrix & rd);
 
+private:
+
+  /** @name Implementations for a given dimension. The matrices for
+   *  all supported spins are handled by separate instantiations with
+   *  the loop lengths fixed at compile time, so that only the used
+   *  part of the storage is touched and the loops can be unrolled. */
+  //@{
+  /**
+   * Set the diagonal elements of an \a N x \a N matrix to 1/\a N.
+   */
+  template <size_t N>
+  void averageN() {
+    for(size_t ix=0; ix<N; ++ix)
+      _matrix[ix][ix] = 1./N;
+  }
+
+  /**
+   * Renormalise an \a N x \a N matrix to unit trace.
+   */
+  template <size_t N>
+  void normalizeN() {
+#ifndef NDEBUG
+    static const double epsa=1e-40, epsb=1e-10;
+#endif
+    Complex norm = 0.;
+    for(size_t ix=0; ix<N; ++ix) 
+      norm += _matrix[ix][ix];
+    assert(norm.real() > epsa);
+    assert(norm.imag()/norm.real() < epsb);
+    double invnorm = 1./norm.real();
+    for(size_t ix=0; ix<N; ++ix)
+      for(size_t iy=0; iy<N; ++iy) 
+	_matrix[ix][iy]*=invnorm;
+  }
+
+  /**
+   * Reset an \a N x \a N matrix.
+   */
+  template <size_t N>
+  void resetN(bool average) {
+    for(size_t ix=0; ix<N; ++ix)
+      for(size_t iy=0; iy<N; ++iy)
+	_matrix[ix][iy]=0.;
+    if ( average ) averageN<N>();
+  }
+  //@}
+
 private:
 
   /**
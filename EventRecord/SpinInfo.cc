@@ -26,7 +26,8 @@ SpinInfo::SpinInfo(const SpinInfo & x)
     _timelike(x._timelike),
     _prodloc(x._prodloc), _decayloc(x._decayloc),
     _decayed(x._decayed), _developed(x._developed),
-    _oldDeveloped(x._oldDeveloped),
+    _oldDeveloped(x._oldDeveloped), _pending(x._pending),
+    _lazy(x._lazy),
     _rhomatrix(x._rhomatrix),
     _Dmatrix(x._Dmatrix),_spin(x._spin),
     _productionmomentum(x._productionmomentum),
@@ -137,14 +138,8 @@ void SpinInfo::undecay() const {
 void SpinInfo::redevelop() const {
   assert(developed()==NeedsUpdate);
   // calculate rho/D matrix
-  if(_timelike) {
-    _Dmatrix   = decayVertex() ? 
-      decayVertex()->getDMatrix(decayLocation()) : RhoDMatrix(iSpin());
-  }
-  else {
-    _rhomatrix = decayVertex() ? 
-      decayVertex()->getRhoMatrix(decayLocation(),false) :  RhoDMatrix(iSpin());
-  }
+  if(_lazy) _pending = true;
+  else      calculateDevelopment();
   // update the D matrix of this spininfo
   if(_developed!=NeedsUpdate) _oldDeveloped=_developed;
   _developed = Developed;
@@ -171,14 +166,8 @@ void SpinInfo::develop() const {
     redevelop();
     return;
   case Undeveloped:
-    if(_timelike) {
-      if(_decay) _Dmatrix = _decay->getDMatrix(_decayloc);
-      else       _Dmatrix = RhoDMatrix(iSpin());
-    }
-    else {
-      if(_decay) _rhomatrix = _decay->getRhoMatrix(_decayloc,false);
-      else       _rhomatrix = RhoDMatrix(iSpin());
-    }
+    if(_lazy) _pending = true;
+    else      calculateDevelopment();
     if(_developed!=NeedsUpdate) _oldDeveloped=_developed;
     _developed=Developed;
     return;
@@ -206,3 +195,14 @@ void SpinInfo::redecay() const {
     _Dmatrix   = productionVertex()->getDMatrix(_prodloc);
 }
 
+void SpinInfo::calculateDevelopment() const {
+  _pending = false;
+  if(_timelike) {
+    _Dmatrix   = decayVertex() ? 
+      decayVertex()->getDMatrix(decayLocation()) : RhoDMatrix(iSpin());
+  }
+  else {
+    _rhomatrix = decayVertex() ? 
+      decayVertex()->getRhoMatrix(decayLocation(),false) :  RhoDMatrix(iSpin());
+  }
+}
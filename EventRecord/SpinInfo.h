@@ -49,6 +49,14 @@ namespace ThePEG {
  *   correlations after all the unstable particles produced by a
  *   decaying particle are decayed.
  *
+ *   If lazyDevelopment() is switched on, develop() only marks the
+ *   matrix as developed, and the actual calculation from the decay
+ *   vertex is postponed until the matrix is accessed, typically when
+ *   the decay of a sibling or parent is performed. Long decay chains
+ *   where no decayer uses the spin correlations are then never
+ *   developed. Note that the calculation uses the decay vertex
+ *   present when the matrix is accessed.
+ *
  *   Methods are also provided to access the spin density and decay
  *   matrices for a particle.
  *
@@ -79,7 +87,7 @@ public:
   SpinInfo() 
     : _timelike(false), _prodloc(-1), _decayloc(-1), 
       _decayed(false), _developed(Undeveloped),
-      _oldDeveloped(Undeveloped) {}
+      _oldDeveloped(Undeveloped), _pending(false), _lazy(false) {}
 
   /**
    * Standard Constructor.
@@ -92,7 +100,8 @@ public:
 	   bool time = false)
     : _timelike(time), _prodloc(-1), _decayloc(-1),
       _decayed(false),
-      _developed(Undeveloped), _oldDeveloped(Undeveloped),
+      _developed(Undeveloped), _oldDeveloped(Undeveloped), _pending(false),
+      _lazy(false),
       _rhomatrix(s), _Dmatrix(s), _spin(s),
       _productionmomentum(p), _currentmomentum(p) {}
 
@@ -307,22 +316,49 @@ public:
   /**
    * Access the rho matrix.
    */
-  RhoDMatrix rhoMatrix() const { return _rhomatrix; }
+  const RhoDMatrix & rhoMatrix() const {
+    if ( _pending ) calculateDevelopment();
+    return _rhomatrix;
+  }
 
   /**
    * Access the rho matrix.
    */
-  RhoDMatrix & rhoMatrix() { return _rhomatrix; }
+  RhoDMatrix & rhoMatrix() {
+    if ( _pending ) calculateDevelopment();
+    return _rhomatrix;
+  }
 
   /**
    * Access the D matrix.
    */
-  RhoDMatrix DMatrix() const { return _Dmatrix; }
+  const RhoDMatrix & DMatrix() const {
+    if ( _pending ) calculateDevelopment();
+    return _Dmatrix;
+  }
 
   /**
    * Access the D matrix.
    */
-  RhoDMatrix & DMatrix() { return _Dmatrix; }
+  RhoDMatrix & DMatrix() {
+    if ( _pending ) calculateDevelopment();
+    return _Dmatrix;
+  }
+  //@}
+
+  /** @name Control the lazy development of the matrices. */
+  //@{
+  /**
+   * Return true if develop() postpones the calculation of the
+   * matrices until they are used.
+   */
+  bool lazyDevelopment() const { return _lazy; }
+
+  /**
+   * Switch on or off the lazy development of the matrices. Typically
+   * set by the DecayHandler for the particles it decays.
+   */
+  void lazyDevelopment(bool b) { _lazy = b; }
   //@}
 
 public:
@@ -359,6 +395,12 @@ private:
    */
   void redecay() const ;
 
+  /**
+   * Calculate the D matrix (or the rho matrix for a spacelike
+   * particle) from the decay vertex.
+   */
+  void calculateDevelopment() const;
+
 private:
 
   /**
@@ -406,6 +448,18 @@ private:
    */
   mutable DevelopedStatus _oldDeveloped;
 
+  /**
+   * True if the particle has been developed but the D matrix (or the
+   * rho matrix for a spacelike particle) has not yet been calculated.
+   */
+  mutable bool _pending;
+
+  /**
+   * True if the development of the matrices is postponed until they
+   * are used.
+   */
+  bool _lazy;
+
   /**
    * Storage of the rho matrix.
    */
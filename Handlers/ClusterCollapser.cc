@@ -103,7 +103,8 @@ collapse(tPVector tagged, tStepPtr newstep) {
       ColourSinglet & cl = clusters.begin()->second;
       for ( int i = 0, N = cl.partons().size(); i < N; ++i )
 	cl.partons()[i] = cl.partons()[i]->final();
-      insert(newClusters, cl);
+      // Swap rather than copy the singlet into the new map.
+      newClusters.insert(make_pair(mass(cl), ColourSinglet()))->second.swap(cl);
       clusters.erase(clusters.begin());
     }
     clusters.swap(newClusters);
@@ -274,44 +275,39 @@ getCompensators(Energy mh, const ColourSinglet & cs,
   tPVector ret;
   tcPVector comp;
   // First find the particles which are not a part of the collapsing
-  // cluster.
+  // cluster. The partons of the cluster are sorted so that this can
+  // be done with a binary search.
+  tcPVector parts(cs.partons().begin(), cs.partons().end());
+  sort(parts.begin(), parts.end());
   tParticleSet compset;
   for ( int i = 0, N = tagged.size(); i < N; ++i )
-    if ( !member(cs.partons(), tagged[i]) ) compset.insert(tagged[i]);
+    if ( !binary_search(parts.begin(), parts.end(), tcPPtr(tagged[i])) )
+      compset.insert(tagged[i]);
 
   LorentzMomentum pcomp;
   LorentzMomentum pc = cs.momentum();
-  // start by only looking at other strings.
-  bool alsoSinglets = false;
-  do {
-    // Return an empty vector if no particles left.
-    if ( compset.empty() ) break;
-
-    // Now find the particle which is closest in phase space to the
-    // cluster.
-    Energy2 dist = Constants::MaxEnergy2;
-    tParticleSet::iterator sel = compset.end();
-    for ( tParticleSet::iterator it = compset.begin();
-	  it != compset.end(); ++it ) {
-      if ( !(**it).coloured() && !alsoSinglets ) continue;
-      if ( -(pc - (**it).momentum()).m2() < dist ) {
-	dist = -(pc - (**it).momentum()).m2();
-	sel = it;
-      }
-    }
 
-    if ( sel == compset.end() ) {
-      if ( alsoSinglets ) break;
-      else {
-	alsoSinglets = true;
-	continue;
-      }
-    }
+  // Order the candidates in their distance in phase space to the
+  // cluster, starting with the ones in other strings and then the
+  // colour singlet ones. Equal distances are ordered as in compset.
+  typedef pair<Energy2,tPPtr> Candidate;
+  vector<Candidate> coloured, singlets;
+  for ( tParticleSet::iterator it = compset.begin();
+	it != compset.end(); ++it )
+    ( (**it).coloured()? coloured: singlets ).
+      push_back(make_pair(-(pc - (**it).momentum()).m2(), *it));
+  sort(coloured.begin(), coloured.end());
+  sort(singlets.begin(), singlets.end());
+  coloured.insert(coloured.end(), singlets.begin(), singlets.end());
+
+  vector<Candidate>::size_type next = 0;
+  do {
+    // Stop if no particles left.
+    if ( next == coloured.size() ) break;
 
-    // Add to the temporary vector.
-    comp.push_back(*sel);
-    pcomp += (**sel).momentum();
-    compset.erase(sel);
+    // Add the closest remaining particle to the temporary vector.
+    comp.push_back(coloured[next].second);
+    pcomp += coloured[next++].second->momentum();
 
     // If there was not enough energy, find an additional compensator
     // particle. Also check that compensators have mass to avoid boost
@@ -499,8 +495,16 @@ tcPDPair ClusterCollapser::getHadrons(const ColourSinglet & cs) const {
   return ret;
 }
 
+void ClusterCollapser::doinitrun() {
+  StepHandler::doinitrun();
+  theFlavours.resize(3);
+  for ( int i = 0; i < 3; ++i ) theFlavours[i] = getParticleData(i + 1);
+}
+
 tcPDPtr ClusterCollapser::pickFlavour() const {
-  return getParticleData(2 + rndsign(1.0, 1.0, pStrange));
+  int i = 1 + rndsign(1.0, 1.0, pStrange);
+  if ( theFlavours.empty() ) return getParticleData(i + 1);
+  return theFlavours[i];
 }
 
 tcPDPtr ClusterCollapser::getHadron(const ColourSinglet & cs) const {
@@ -235,6 +235,17 @@ protected:
   virtual IBPtr fullclone() const;
   //@}
 
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+  //@}
+
   /** @cond EXCEPTIONCLASSES */
   /** Exception class used by ClusterCollapser. */
   class ClusterException: public Exception {
@@ -283,6 +294,14 @@ protected:
    */
   double pStrange;
 
+private:
+
+  /**
+   * The d, u and s quarks from which pickFlavour() selects, set up in
+   * doinitrun() to avoid looking them up for each cluster.
+   */
+  tcPDVector theFlavours;
+
 private:
 
   /**
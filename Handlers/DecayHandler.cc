@@ -19,6 +19,10 @@
 #include "ThePEG/EventRecord/Particle.h"
 #include "ThePEG/EventRecord/Step.h"
 #include "ThePEG/EventRecord/Collision.h"
+#include "ThePEG/EventRecord/SpinInfo.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Utilities/Throw.h"
 #include "ThePEG/Interface/Switch.h"
 #include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
@@ -49,6 +53,8 @@ handle(EventHandler &, const tPVector & tagged,
 
   if ( parents.empty() ) return;
 
+  if ( !theCompiled ) compileDecayTables();
+
   // Create a new step, decay all particles and add their children in
   // the new step.
   for ( int i = 0, N = parents.size(); i < N; ++i )
@@ -64,17 +70,86 @@ performDecay(tPPtr parent, Step & s) const {
       return;
     }
   }
-  ParticleVector children = Decayer::DecayParticle(parent, s, maxLoop());
+  // Postpone the development of the spin density matrices of the
+  // particles decayed here, also if the decayer created the SpinInfo.
+  if ( lazySpinDevelopment() && parent->spinInfo() )
+    parent->spinInfo()->lazyDevelopment(true);
+  ParticleVector children = decayParticle(parent, s);
+  if ( lazySpinDevelopment() && parent->final()->spinInfo() )
+    parent->final()->spinInfo()->lazyDevelopment(true);
   for ( int i = 0, N = children.size(); i < N; ++i )
     if ( !children[i]->data().stable() ) performDecay(children[i], s);
 }
 
+ParticleVector DecayHandler::decayParticle(tPPtr parent, Step & s) const {
+  auto it = theDecayTableIndex.find(&parent->data());
+  if ( it == theDecayTableIndex.end() )
+    return Decayer::DecayParticle(parent, s, maxLoop());
+  const AliasTable<tDMPtr> & table = theDecayTables[it->second];
+  ParticleVector children;
+  parent = parent->final();
+  if ( parent->decayed() ) return children;
+  if ( table.empty() ) Throw<Decayer::DecayFailure>()
+    << "Could not decay particle " << parent->data().PDGName()
+    << " since none of its decay modes has a positive branching ratio."
+    << Exception::eventerror;
+  long itry = 0;
+  while ( true ) {
+    if ( itry++ >= maxLoop() ) Throw<Decayer::DecayFailure>()
+      << "Could not decay particle " << parent->data().PDGName() << " after "
+      << maxLoop() << " attempts. Giving up." << Exception::eventerror;
+    children = Decayer::DecayParticle(parent, s,
+				      table.select(UseRandom::rnd()));
+    if ( !children.empty() ) return children;
+  }
+}
+
+void DecayHandler::doinitrun() {
+  StepHandler::doinitrun();
+  // The decayers may still change the branching ratios when they are
+  // initialized, so the tables are compiled when first needed.
+  theDecayTables.clear();
+  theDecayTableIndex.clear();
+  theCompiled = false;
+}
+
+void DecayHandler::compileDecayTables() {
+  theDecayTables.clear();
+  theDecayTableIndex.clear();
+  theCompiled = true;
+  const ParticleMap & particles = generator()->particles();
+  for ( ParticleMap::const_iterator it = particles.begin();
+	it != particles.end(); ++it ) {
+    const ParticleData & pd = *it->second;
+    // Particles with branching ratios depending on the mass of the
+    // decaying particle are still handled by ParticleData::selectMode().
+    if ( pd.stable() || pd.decaySelector().empty() ||
+	 ( pd.widthGenerator() && pd.variableRatio() ) ) continue;
+    vector<tDMPtr> modes;
+    vector<double> brats;
+    double last = 0.0;
+    for ( ParticleData::DecaySelector::const_iterator mit =
+	    pd.decaySelector().begin();
+	  mit != pd.decaySelector().end(); ++mit ) {
+      modes.push_back(mit->second);
+      brats.push_back(mit->first - last);
+      last = mit->first;
+    }
+    theDecayTableIndex[&pd] = theDecayTables.size();
+    theDecayTables.push_back(AliasTable<tDMPtr>());
+    theDecayTables.back().build(modes, brats);
+  }
+}
+
 void DecayHandler::persistentOutput(PersistentOStream & os) const {
-  os << theMaxLoop << ounit(theMaxLifeTime, mm) << theLifeTimeOption;
+  os << theMaxLoop << ounit(theMaxLifeTime, mm) << theLifeTimeOption
+     << theLazySpinDevelopment;
 }
 
-void DecayHandler::persistentInput(PersistentIStream & is, int) {
+void DecayHandler::persistentInput(PersistentIStream & is, int version) {
   is >> theMaxLoop >> iunit(theMaxLifeTime, mm) >> theLifeTimeOption;
+  if ( version >= 1 ) is >> theLazySpinDevelopment;
+  else theLazySpinDevelopment = false;
 }
 
 ClassDescription<DecayHandler> DecayHandler::initDecayHandler;
@@ -114,5 +189,22 @@ void DecayHandler::Init() {
      "Cut on the lifetime generated for the given instance",
      true);
 
+  static Switch<DecayHandler,bool> interfaceLazySpinDevelopment
+    ("LazySpinDevelopment",
+     "Only calculate the spin density and decay matrices of particles in "
+     "a decay chain when they are used by a decayer implementing spin "
+     "correlations, rather than whenever the decays are developed.",
+     &DecayHandler::theLazySpinDevelopment, false, true, false);
+  static SwitchOption interfaceLazySpinDevelopmentYes
+    (interfaceLazySpinDevelopment,
+     "Yes",
+     "Calculate the matrices when used.",
+     true);
+  static SwitchOption interfaceLazySpinDevelopmentNo
+    (interfaceLazySpinDevelopment,
+     "No",
+     "Calculate the matrices when the decays are developed.",
+     false);
+
 }
 
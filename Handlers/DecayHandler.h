@@ -11,6 +11,8 @@
 // This is the declaration of the DecayHandler class.
 
 #include "StepHandler.h"
+#include "ThePEG/Utilities/AliasTable.h"
+#include <unordered_map>
 
 namespace ThePEG {
 
@@ -37,7 +39,9 @@ public:
   /**
    * Default constructor.
    */
-  DecayHandler() : theMaxLoop(100000), theMaxLifeTime(-1.0*mm), theLifeTimeOption(false) {}
+  DecayHandler() : theCompiled(false), theMaxLoop(100000),
+		   theMaxLifeTime(-1.0*mm), theLifeTimeOption(false),
+		   theLazySpinDevelopment(false) {}
 
   /**
    * Destructor.
@@ -67,6 +71,16 @@ public:
    */
   void performDecay(tPPtr parent, Step & s) const;
 
+  /**
+   * Decay one unstable particle using the compiled decay table if
+   * available, otherwise using
+   * Decayer::DecayParticle().
+   * @param parent the particle to be decayed.
+   * @param s the Step where decay products are inserted.
+   * @return the produced children.
+   */
+  ParticleVector decayParticle(tPPtr parent, Step & s) const;
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -108,6 +122,14 @@ public:
    */
   bool lifeTimeOption() const { return theLifeTimeOption; }
 
+  /**
+   * True if the spin density matrices of decay chains should only be
+   * developed when used. If so, the SpinInfo objects of the particles
+   * decayed by this handler are marked with
+   * SpinInfo::lazyDevelopment(bool).
+   */
+  bool lazySpinDevelopment() const { return theLazySpinDevelopment; }
+
 protected:
 
   /** @name Clone Methods. */
@@ -125,8 +147,43 @@ protected:
   virtual IBPtr fullclone() const;
   //@}
 
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before a
+   * run begins. Clears the decay tables, which are compiled in the
+   * first call to handle().
+   */
+  virtual void doinitrun();
+  //@}
+
+  /**
+   * Compile the decay tables for all particle types in the current
+   * EventGenerator which have fixed branching ratios.
+   */
+  void compileDecayTables();
+
 private:
 
+  /**
+   * The compiled decay tables. For each particle type the open decay
+   * modes are selected in constant time according to their branching
+   * ratios.
+   */
+  vector< AliasTable<tDMPtr> > theDecayTables;
+
+  /**
+   * The index in theDecayTables for each compiled particle type.
+   */
+  std::unordered_map<const ParticleData *, int> theDecayTableIndex;
+
+  /**
+   * True if the decay tables have been compiled.
+   */
+  bool theCompiled;
+
   /**
    * The maximum number of failed decay attempts allowed for each
    * particle.
@@ -143,6 +200,12 @@ private:
    */
   bool theLifeTimeOption;
 
+  /**
+   * True if the spin density matrices of decay chains should only be
+   * developed when used.
+   */
+  bool theLazySpinDevelopment;
+
 private:
 
   /**
@@ -177,6 +240,9 @@ template <>
 struct ClassTraits<DecayHandler>: public ClassTraitsBase<DecayHandler> {
   /** Return the class name. */
   static string className() { return "ThePEG::DecayHandler"; }
+  /** Return the class version. Version 1 added the switch for lazy
+   *  development of spin density matrices. */
+  static int version() { return 1; }
 };
 
 /** @endcond */
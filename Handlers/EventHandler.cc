@@ -33,6 +33,7 @@
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Handlers/LuminosityFunction.h"
 #include "ThePEG/Utilities/Throw.h"
+#include "ThePEG/Utilities/Profiler.h"
 #include "ThePEG/Utilities/EnumIO.h"
 #include "ThePEG/Utilities/Rebinder.h"
 
@@ -59,7 +60,8 @@ EventHandler(const EventHandler & x)
     theCascadeGroup(x.theCascadeGroup), theMultiGroup(x.theMultiGroup),
     theHadronizationGroup(x.theHadronizationGroup),
     theDecayGroup(x.theDecayGroup), warnIncomplete(x.warnIncomplete),
-    theIncoming(x.theIncoming) {
+    theIncoming(x.theIncoming), theWeightNames(x.theWeightNames),
+    theWeightIndices(x.theWeightIndices) {
   setupGroups();
 }
 
@@ -193,6 +195,7 @@ performStep(tStepHdlPtr handler, tHintPtr hint) {
   handler->eventHandler(this);
   try {
     generator()->currentStepHandler(handler);
+    Profiler::Timer timer(Profiler::stepHandler, handler);
     handler->handle(*this, hint->tagged(*oldStep), *hint);
     generator()->currentStepHandler(tStepHdlPtr());
   }
@@ -244,6 +247,21 @@ void EventHandler::clean() {
 
 void EventHandler::statistics(ostream &) const {}
 
+size_t EventHandler::weightIndex(const string & name) {
+  map<string,size_t>::const_iterator it = theWeightIndices.find(name);
+  if ( it != theWeightIndices.end() ) return it->second;
+  theWeightNames.push_back(name);
+  return theWeightIndices[name] = theWeightNames.size() - 1;
+}
+
+map<string,double> EventHandler::optionalWeights(const Event & event) const {
+  map<string,double> ret = event.optionalWeights();
+  const vector<double> & w = event.weightVector();
+  for ( size_t i = 0, N = min(w.size(), theWeightNames.size()); i < N; ++i )
+    if ( event.hasVariationWeight(i) ) ret[theWeightNames[i]] = w[i];
+  return ret;
+}
+
 void EventHandler::initialize() {}
 
 EventPtr EventHandler::continueEvent() {
@@ -366,10 +384,10 @@ void EventHandler::persistentOutput(PersistentOStream & os) const {
      << theSubprocessGroup << theCascadeGroup << theMultiGroup
      << theHadronizationGroup << theDecayGroup << theCurrentEvent
      << theCurrentCollision << theCurrentStep << theCurrentStepHandler
-     << warnIncomplete << theIncoming;
+     << warnIncomplete << theIncoming << theWeightNames;
 }
 
-void EventHandler::persistentInput(PersistentIStream & is, int) {
+void EventHandler::persistentInput(PersistentIStream & is, int version) {
   is >> theLastXComb >> theMaxLoop >> weightedEvents
      >> theStatLevel >> ienum(theConsistencyLevel)
      >> theConsistencyEpsilon >> theLumiFn >> theCuts >> thePartonExtractor
@@ -377,6 +395,11 @@ void EventHandler::persistentInput(PersistentIStream & is, int) {
      >> theHadronizationGroup >> theDecayGroup >> theCurrentEvent
      >> theCurrentCollision >> theCurrentStep >> theCurrentStepHandler
      >> warnIncomplete >> theIncoming;
+  theWeightNames.clear();
+  theWeightIndices.clear();
+  if ( version >= 1 ) is >> theWeightNames;
+  for ( size_t i = 0, N = theWeightNames.size(); i < N; ++i )
+    theWeightIndices[theWeightNames[i]] = i;
 }
 
 ThePEG_IMPLEMENT_CLASS_DESCRIPTION(EventHandler);
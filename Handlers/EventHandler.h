@@ -285,6 +285,30 @@ public:
 
   //@}
 
+  /** @name Functions for handling variation weights. */
+  //@{
+  /**
+   * Return the index in Event::weightVector() of the variation weight
+   * with the given \a name. If the name has not been used before in
+   * this run, it is added to the list of weight names.
+   */
+  size_t weightIndex(const string & name);
+
+  /**
+   * The names of the variation weights used so far in this run,
+   * ordered as the weights in Event::weightVector().
+   */
+  const vector<string> & weightNames() const { return theWeightNames; }
+
+  /**
+   * Return all the optional weights of the given \a event as a map
+   * indexed by name, both the ones in Event::optionalWeights() and
+   * the variation weights in Event::weightVector(). Variations which
+   * were not produced for the event are not included.
+   */
+  map<string,double> optionalWeights(const Event & event) const;
+  //@}
+
   /** @name Internal functions used by main functions and possibly
       from the outside. */
   //@{
@@ -614,6 +638,18 @@ protected:
    */
   cPDPair theIncoming;
 
+private:
+
+  /**
+   * The names of the variation weights used in this run.
+   */
+  vector<string> theWeightNames;
+
+  /**
+   * The indices of the names in theWeightNames.
+   */
+  map<string,size_t> theWeightIndices;
+
 protected:
 
   /** @cond EXCEPTIONCLASSES */
@@ -673,7 +709,30 @@ private:
 };
 
 /** @cond TRAITSPECIALIZATIONS */
-ThePEG_DECLARE_CLASS_TRAITS(EventHandler,HandlerBase);
+
+/**
+ * This template specialization informs ThePEG about the
+ * base class of EventHandler.
+ */
+template <>
+struct BaseClassTrait<EventHandler,1>: public ClassTraitsType {
+  /** Typedef of the base class of EventHandler. */
+  typedef HandlerBase NthBase;
+};
+
+/**
+ * This template specialization informs ThePEG about the name of the
+ * EventHandler class.
+ */
+template <>
+struct ClassTraits<EventHandler>: public ClassTraitsBase<EventHandler> {
+  /** Return the class name. */
+  static string className() { return "ThePEG::EventHandler"; }
+  /** Return the class version. Version 1 added the names of the
+   *  variation weights. */
+  static int version() { return 1; }
+};
+
 /** @endcond */
 
 }
@@ -0,0 +1,247 @@
+// -*- C++ -*-
+//
+// PDFReweighter.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the PDFReweighter class.
+//
+
+#include "PDFReweighter.h"
+#include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/RefVector.h"
+#include "ThePEG/Interface/Switch.h"
+#include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Handlers/EventHandler.h"
+#include "ThePEG/Handlers/StandardXComb.h"
+#include "ThePEG/MatrixElement/MEBase.h"
+#include "ThePEG/EventRecord/Event.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Utilities/DescribeClass.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+
+using namespace ThePEG;
+
+PDFReweighter::PDFReweighter()
+  : theAllMembers(true), theAlphaSPower(-1), theCacheSize(16),
+    theNCached(0), theNextCached(0), theLastCached(0) {}
+
+PDFReweighter::~PDFReweighter() {}
+
+IBPtr PDFReweighter::clone() const {
+  return new_ptr(*this);
+}
+
+IBPtr PDFReweighter::fullclone() const {
+  return new_ptr(*this);
+}
+
+void PDFReweighter::doinitrun() {
+  StepHandler::doinitrun();
+  // The weight indices are set up with the event handler in the
+  // first call to handle().
+  theWeightIndices.clear();
+  theNMembers.clear();
+  theCache.clear();
+  theCache.reserve(theCacheSize);
+  theNCached = theNextCached = theLastCached = 0;
+  for ( int i = 0, N = theAlphaS.size(); i < N; ++i ) {
+    theAlphaS[i]->initrun();
+    theAlphaS[i]->tabulate(*generator()->standardModel());
+  }
+}
+
+void PDFReweighter::setupWeights(EventHandler & eh) {
+  theNMembers.resize(thePDFs.size());
+  int maxMembers = 1;
+  for ( int i = 0, N = thePDFs.size(); i < N; ++i ) {
+    theNMembers[i] = theAllMembers? thePDFs[i]->nMembers(): 1;
+    maxMembers = max(maxMembers, theNMembers[i]);
+    if ( theNMembers[i] == 1 ) {
+      theWeightIndices.push_back(eh.weightIndex(thePDFs[i]->name()));
+      continue;
+    }
+    for ( int m = 0; m < theNMembers[i]; ++m ) {
+      ostringstream os;
+      os << thePDFs[i]->name() << ":" << m;
+      theWeightIndices.push_back(eh.weightIndex(os.str()));
+    }
+  }
+  for ( int i = 0, N = theAlphaS.size(); i < N; ++i )
+    theWeightIndices.push_back(eh.weightIndex(theAlphaS[i]->name()));
+  theWeights.resize(maxMembers);
+  theOnes.assign(maxMembers, 1.0);
+}
+
+const double * PDFReweighter::
+densities(tcPDFPtr pdf, const PartonBinInstance & pb, bool all) {
+  tcPDPtr particle = pb.particleData();
+  tcPDPtr parton = pb.partonData();
+  double x = pb.xi();
+  Energy2 scale = pb.scale();
+  for ( size_t i = 0; i < theNCached; ++i ) {
+    const CachedDensity & c = theCache[i];
+    if ( c.pdf == pdf && c.particle == particle && c.parton == parton &&
+	 c.x == x && c.scale == scale && c.all == all ) {
+      theLastCached = i;
+      return c.xf.data();
+    }
+  }
+  // Replace the oldest entry if the cache is full, reusing its
+  // storage. The entry returned last may still be in use for the
+  // other side of the event and is skipped.
+  size_t i = theNCached;
+  if ( theNCached < size_t(theCacheSize) ) {
+    if ( theNCached == theCache.size() ) theCache.push_back(CachedDensity());
+    ++theNCached;
+  } else {
+    if ( theNextCached == theLastCached )
+      theNextCached = ( theNextCached + 1 )%theCacheSize;
+    i = theNextCached;
+    theNextCached = ( theNextCached + 1 )%theCacheSize;
+  }
+  theLastCached = i;
+  CachedDensity & c = theCache[i];
+  c.pdf = pdf;
+  c.particle = particle;
+  c.parton = parton;
+  c.x = x;
+  c.scale = scale;
+  c.all = all;
+  if ( all ) {
+    c.xf.resize(pdf->nMembers());
+    pdf->xfxMembers(particle, parton, scale, x, c.xf.data());
+  } else {
+    c.xf.resize(1);
+    c.xf[0] = pdf->xfx(particle, parton, scale, x);
+  }
+  return c.xf.data();
+}
+
+void PDFReweighter::
+handle(EventHandler & eh, const tPVector &, const Hint &) {
+  tStdXCombPtr xc = dynamic_ptr_cast<tStdXCombPtr>(eh.lastXCombPtr());
+  tEventPtr event = eh.currentEvent();
+  if ( !xc || !event ) return;
+  if ( theWeightIndices.empty() ) setupWeights(eh);
+
+  const double weight = event->weight();
+
+  // The densities used in the generation for each side. If a side has
+  // no density it is not reweighted.
+  const PBIPair & pbis = xc->partonBinInstances();
+  const PartonBinInstance * pb[2] = { pbis.first.operator->(),
+				      pbis.second.operator->() };
+  double inv0[2] = { 0.0, 0.0 };
+  bool vary[2] = { false, false };
+  for ( int side = 0; side < 2; ++side ) {
+    if ( !pb[side] || !pb[side]->pdf() ) continue;
+    double xf0 = *densities(pb[side]->pdf(), *pb[side], false);
+    vary[side] = true;
+    inv0[side] = xf0 != 0.0? 1.0/xf0: 0.0;
+  }
+
+  int iw = 0;
+  for ( int i = 0, N = thePDFs.size(); i < N; ++i ) {
+    const int n = theNMembers[i];
+    const double * xf[2] = { theOnes.data(), theOnes.data() };
+    double norm = weight;
+    for ( int side = 0; side < 2; ++side ) {
+      if ( !vary[side] ||
+	   !thePDFs[i]->canHandleParticle(pb[side]->particleData()) )
+	continue;
+      xf[side] = densities(thePDFs[i], *pb[side], theAllMembers);
+      norm *= inv0[side];
+    }
+    const double * xf1 = xf[0];
+    const double * xf2 = xf[1];
+    double * w = theWeights.data();
+    for ( int m = 0; m < n; ++m ) w[m] = norm*xf1[m]*xf2[m];
+    for ( int m = 0; m < n; ++m )
+      event->variationWeight(theWeightIndices[iw++], w[m]);
+  }
+
+  if ( theAlphaS.empty() ) return;
+  const double as0 = xc->lastAlphaS();
+  const int power = theAlphaSPower >= 0? theAlphaSPower:
+    int(xc->matrixElement()->orderInAlphaS());
+  const Energy2 scale = xc->lastScale();
+  for ( int i = 0, N = theAlphaS.size(); i < N; ++i ) {
+    double r = as0 > 0.0? theAlphaS[i]->value(scale)/as0: 1.0;
+    event->variationWeight(theWeightIndices[iw++], weight*pow(r, power));
+  }
+}
+
+void PDFReweighter::persistentOutput(PersistentOStream & os) const {
+  os << thePDFs << theAllMembers << theAlphaS << theAlphaSPower
+     << theCacheSize;
+}
+
+void PDFReweighter::persistentInput(PersistentIStream & is, int) {
+  is >> thePDFs >> theAllMembers >> theAlphaS >> theAlphaSPower
+     >> theCacheSize;
+}
+
+
+// The following static variable is needed for the type
+// description system in ThePEG.
+DescribeClass<PDFReweighter,StepHandler>
+describeThePEGPDFReweighter("ThePEG::PDFReweighter", "PDFReweighter.so");
+
+void PDFReweighter::Init() {
+
+  static ClassDocumentation<PDFReweighter> documentation
+    ("The ThePEG::PDFReweighter class calculates variation weights for "
+     "alternative parton densities and running couplings on the fly. It "
+     "should be inserted as a post sub-process handler in a "
+     "ThePEG::StandardEventHandler.");
+
+  static RefVector<PDFReweighter,PDFBase> interfacePDFs
+    ("PDFs",
+     "The alternative parton densities for which variation weights are "
+     "calculated.",
+     &PDFReweighter::thePDFs, -1, true, false, true, false, false);
+
+  static Switch<PDFReweighter,bool> interfaceAllMembers
+    ("AllMembers",
+     "Use all members of the alternative parton densities (eg. the error "
+     "members of an LHAPDF set) rather than only the chosen one.",
+     &PDFReweighter::theAllMembers, true, true, false);
+  static SwitchOption interfaceAllMembersYes
+    (interfaceAllMembers,
+     "Yes",
+     "Calculate a variation weight for each member.",
+     true);
+  static SwitchOption interfaceAllMembersNo
+    (interfaceAllMembers,
+     "No",
+     "Calculate a variation weight for the chosen member only.",
+     false);
+
+  static RefVector<PDFReweighter,AlphaSBase> interfaceAlphaS
+    ("AlphaS",
+     "The alternative running couplings for which variation weights are "
+     "calculated.",
+     &PDFReweighter::theAlphaS, -1, true, false, true, false, false);
+
+  static Parameter<PDFReweighter,int> interfaceAlphaSPower
+    ("AlphaSPower",
+     "The power of the coupling used for the variations of the running "
+     "coupling. If negative, the order in the coupling of the matrix "
+     "element is used.",
+     &PDFReweighter::theAlphaSPower, -1, -1, 0, true, false, Interface::lowerlim);
+
+  static Parameter<PDFReweighter,int> interfaceCacheSize
+    ("CacheSize",
+     "The number of density evaluations which are cached. Each entry "
+     "holds the densities of all members of one PDF for one incoming "
+     "particle, parton, momentum fraction and scale, and when the cache "
+     "is full the oldest entry is replaced.",
+     &PDFReweighter::theCacheSize, 16, 2, 0, true, false, Interface::lowerlim);
+
+}
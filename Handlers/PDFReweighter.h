@@ -0,0 +1,274 @@
+// -*- C++ -*-
+//
+// PDFReweighter.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_PDFReweighter_H
+#define ThePEG_PDFReweighter_H
+//
+// This is the declaration of the PDFReweighter class.
+//
+
+#include "ThePEG/Handlers/StepHandler.h"
+#include "ThePEG/PDF/PDFBase.h"
+#include "ThePEG/PDF/PartonBinInstance.h"
+#include "ThePEG/StandardModel/AlphaSBase.h"
+
+namespace ThePEG {
+
+/**
+ * The PDFReweighter class is a StepHandler which calculates variation
+ * weights for alternative parton densities and running couplings on
+ * the fly. It should be inserted as a post sub-process handler in a
+ * StandardEventHandler.
+ *
+ * For each event the densities of the incoming partons of the hard
+ * sub-process are evaluated with each of the given PDFs and the
+ * ratio to the densities used in the generation is multiplied with
+ * the event weight. Optionally all members of the given PDFs (eg. the
+ * error members of an LHAPDF set) are used. In addition the ratio of
+ * each of the given AlphaSBase objects to the coupling used in the
+ * generation is taken to the power of the order in \f$\alpha_S\f$ of
+ * the matrix element. The resulting weights are stored in the
+ * Event::weightVector() with the names given by the name of the PDF
+ * object (with the member number appended if all members are used)
+ * or the AlphaSBase object.
+ *
+ * The densities of all members of a set are evaluated together, and
+ * the results are cached for the last few sets of (PDF, particle,
+ * parton, x, Q2), as given by the CacheSize parameter. Each density
+ * is therefore only evaluated once per event, and points which recur
+ * in later events (eg. x = 1 for incoming leptons or the same parton
+ * on both sides) are not evaluated again.
+ *
+ * @see \ref PDFReweighterInterfaces "The interfaces"
+ * defined for PDFReweighter.
+ */
+class PDFReweighter: public StepHandler {
+
+public:
+
+  /** A vector of pointers to AlphaSBase objects. */
+  typedef vector<Ptr<AlphaSBase>::pointer> ASVector;
+
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * The default constructor.
+   */
+  PDFReweighter();
+
+  /**
+   * The destructor.
+   */
+  virtual ~PDFReweighter();
+  //@}
+
+public:
+
+  /** @name Virtual functions required by the StepHandler class. */
+  //@{
+  /**
+    * The main function called by the EventHandler class to
+    * perform a step. Calculates the variation weights for the
+    * current event.
+    * @param eh the EventHandler in charge of the Event generation.
+    * @param tagged if not empty these are the only particles which should
+    * be considered by the StepHandler.
+    * @param hint a Hint object with possible information from previously
+    * performed steps.
+    */
+  virtual void handle(EventHandler & eh, const tPVector & tagged,
+		      const Hint & hint);
+  //@}
+
+protected:
+
+  /**
+   * Register the names of the variation weights with the given event
+   * handler and set up the index of each weight.
+   */
+  void setupWeights(EventHandler & eh);
+
+  /**
+   * Return the densities of all members of \a pdf (or only the first
+   * if \a all is false) for the parton in the given parton bin. The
+   * values are cached for the last theCacheSize points, replacing the
+   * oldest entry when the cache is full.
+   */
+  const double * densities(tcPDFPtr pdf, const PartonBinInstance & pb,
+			   bool all);
+
+public:
+
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
+  /**
+   * The standard Init function used to initialize the interfaces.
+   * Called exactly once for each class by the class description system
+   * before the main function starts or
+   * when this class is dynamically loaded.
+   */
+  static void Init();
+
+protected:
+
+  /** @name Clone Methods. */
+  //@{
+  /**
+   * Make a simple clone of this object.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr clone() const;
+
+  /** Make a clone of this object, possibly modifying the cloned object
+   * to make it sane.
+   * @return a pointer to the new object.
+   */
+  virtual IBPtr fullclone() const;
+  //@}
+
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+  //@}
+
+private:
+
+  /**
+   * A cached density evaluation.
+   */
+  struct CachedDensity {
+
+    /** The PDF used. */
+    tcPDFPtr pdf;
+
+    /** The incoming particle. */
+    tcPDPtr particle;
+
+    /** The extracted parton. */
+    tcPDPtr parton;
+
+    /** The momentum fraction. */
+    double x;
+
+    /** The scale. */
+    Energy2 scale;
+
+    /** True if all members were evaluated. */
+    bool all;
+
+    /** The values for each member. */
+    vector<double> xf;
+
+  };
+
+private:
+
+  /**
+   * The alternative PDFs.
+   */
+  vector<PDFPtr> thePDFs;
+
+  /**
+   * If true, all members of the alternative PDFs are used.
+   */
+  bool theAllMembers;
+
+  /**
+   * The alternative running couplings.
+   */
+  ASVector theAlphaS;
+
+  /**
+   * The power of \f$\alpha_S\f$ used for the coupling
+   * variations. If negative, the order in \f$\alpha_S\f$ of the
+   * matrix element is used.
+   */
+  int theAlphaSPower;
+
+  /**
+   * The number of members used for each of thePDFs.
+   */
+  vector<int> theNMembers;
+
+  /**
+   * The index in the event weight vector for each variation weight,
+   * first the members of each PDF and then each coupling.
+   */
+  vector<size_t> theWeightIndices;
+
+  /**
+   * The maximum number of density evaluations kept in theCache.
+   */
+  int theCacheSize;
+
+  /**
+   * The cached density evaluations. Only the first theNCached entries
+   * are valid.
+   */
+  vector<CachedDensity> theCache;
+
+  /**
+   * The number of valid entries in theCache.
+   */
+  size_t theNCached;
+
+  /**
+   * The entry in theCache to be replaced next when it is full.
+   */
+  size_t theNextCached;
+
+  /**
+   * The entry in theCache returned by the last call to densities().
+   */
+  size_t theLastCached;
+
+  /**
+   * Work space for the weights of one PDF.
+   */
+  vector<double> theWeights;
+
+  /**
+   * A vector of ones used for sides which are not reweighted.
+   */
+  vector<double> theOnes;
+
+private:
+
+  /**
+   * The assignment operator is private and must never be called.
+   * In fact, it should not even be implemented.
+   */
+  PDFReweighter & operator=(const PDFReweighter &) = delete;
+
+};
+
+}
+
+#endif /* ThePEG_PDFReweighter_H */
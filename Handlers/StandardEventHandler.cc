@@ -60,11 +60,14 @@ void StandardEventHandler::reweight(double factor) const {
   double weight = currentEvent()->weight();
   last->reweight(weight,factor*weight);
   xSecStats.reweight(weight,factor*weight);
+  xSecStats.reweightVariations(factor);
   currentEvent()->weight(factor*weight);
   for ( map<string,double>::iterator w = 
 	  currentEvent()->optionalWeights().begin();
 	w != currentEvent()->optionalWeights().end(); ++w )
     w->second *= factor;
+  vector<double> & wv = currentEvent()->weightVector();
+  for ( int i = 0, N = wv.size(); i < N; ++i ) wv[i] *= factor;
 }
 
 void StandardEventHandler::doupdate() {
@@ -163,9 +166,11 @@ tCollPtr StandardEventHandler::performCollision() {
 
   currentStep()->addSubProcess(lastXC->construct());
   if ( currentEvent() ) {
-    map<string,double> optionalWeights = lastXC->generateOptionalWeights();
-    for ( const auto& weight : optionalWeights )
-      currentEvent()->optionalWeights().insert(weight);
+    if ( !lastXC->fillOptionalWeights(*currentEvent()) ) {
+      map<string,double> optionalWeights = lastXC->generateOptionalWeights();
+      for ( const auto& weight : optionalWeights )
+	currentEvent()->optionalWeights().insert(weight);
+    }
   }
 
   lastExtractor()->construct(lastXC->partonBinInstances(), currentStep());
@@ -229,10 +234,7 @@ void StandardEventHandler::initialize() {
 CrossSection StandardEventHandler::
 dSigDR(const pair<double,double> ll, Energy2 maxS,
        int ibin, int nr, const double * r) {
-  PPair inc = make_pair(incoming().first->produceParticle(),
-			incoming().second->produceParticle());
-  SimplePhaseSpace::CMS(inc, maxS);
-  xCombs()[ibin]->prepare(inc);
+  xCombs()[ibin]->prepare(maxS);
   return xCombs()[ibin]->dSigDR(ll, nr, r);
 }
 
@@ -241,6 +243,8 @@ tStdXCombPtr StandardEventHandler::select(int bin, double & weight) {
   // clean up the old XComb object before switching to a new one
   if ( theLastXComb && theLastXComb != lastXC ) theLastXComb->clean();
   theLastXComb = lastXC;
+  // The instances of the last phase space point now belong to the event.
+  lastXC->releaseInstances();
   weight /= lastXC->matrixElement()->preWeight();
   lastXC->select(weight);
   xSecStats.select(weight);
@@ -308,6 +312,19 @@ void StandardEventHandler::statistics(ostream & os) const {
 
   if ( statLevel() == 1 ) return;
 
+  if ( xSecStats.nVariations() ) {
+    os << "Per variation weight breakdown:\n";
+    for ( size_t i = 0, N = xSecStats.nVariations(); i < N; ++i ) {
+      string n = weightNames()[i];
+      n.resize(61, ' ');
+      os << n << setw(17)
+	 << ouniterr(integratedVariationXSec(i),
+		     integratedVariationXSecErr(i), nanobarn)
+	 << endl;
+    }
+    os << line;
+  }
+
   os << "Per matrix element breakdown:\n";
   for ( map<MEPtr, XSecStat>::iterator i = meMap.begin();
 	i != meMap.end(); ++i ) {
@@ -383,6 +400,17 @@ CrossSection StandardEventHandler::integratedXSecErr() const {
   return xSecStats.xSecErr(sampler()->attempts());
 }
 
+CrossSection StandardEventHandler::integratedVariationXSec(size_t i) const {
+  xSecStats.maxXSec(sampler()->maxXSec());
+  return xSecStats.variationXSec(i, sampler()->attempts());
+}
+
+CrossSection StandardEventHandler::
+integratedVariationXSecErr(size_t i) const {
+  xSecStats.maxXSec(sampler()->maxXSec());
+  return xSecStats.variationXSecErr(i, sampler()->attempts());
+}
+
 CrossSection StandardEventHandler::integratedXSecNoReweight() const {
   xSecStats.maxXSec(sampler()->maxXSec());
   return xSecStats.xSecNoReweight(sampler()->attempts());
@@ -441,6 +469,13 @@ EventPtr StandardEventHandler::generateEvent() {
       performCollision();
       if ( !currentCollision() ) throw Veto();
 
+      // Variation weights may also have been added by the step
+      // handlers, so they are only accumulated when the collision is
+      // complete.
+      if ( !currentEvent()->weightVector().empty() )
+	xSecStats.variations(currentEvent()->weightVector(),
+			     currentEvent()->weightMask());
+
       currentEvent()->transform(currentEventBoost());
 
       return currentEvent();
@@ -583,10 +618,12 @@ void StandardEventHandler::Init() {
 void StandardEventHandler::persistentOutput(PersistentOStream & os) const {
   os << theIncomingA << theIncomingB << theSubProcesses << theCuts << collisionCuts
      << theXCombs << theMaxDims << theSampler << theLumiDim << xSecStats;
+  xSecStats.outputVariations(os);
 }
 
-void StandardEventHandler::persistentInput(PersistentIStream & is, int) {
+void StandardEventHandler::persistentInput(PersistentIStream & is, int version) {
   is >> theIncomingA >> theIncomingB >> theSubProcesses >> theCuts >> collisionCuts
      >> theXCombs >> theMaxDims >> theSampler >> theLumiDim >> xSecStats;
+  if ( version >= 1 ) xSecStats.inputVariations(is);
 }
 
@@ -135,6 +135,20 @@ public:
    */
   virtual CrossSection integratedXSecErrNoReweight() const;
 
+  /**
+   * The estimated total integrated cross section of the processes
+   * generated in this run for the variation weight with index \a i
+   * in weightNames().
+   */
+  CrossSection integratedVariationXSec(size_t i) const;
+
+  /**
+   * The estimated error in the total integrated cross section of the
+   * processes generated in this run for the variation weight with
+   * index \a i in weightNames().
+   */
+  CrossSection integratedVariationXSecErr(size_t i) const;
+
   /** @name Functions used for the actual generation */
   //@{
   /**
@@ -502,6 +516,11 @@ struct ClassTraits<StandardEventHandler>
    * Return the class name.
    */
   static string className() { return "ThePEG::StandardEventHandler"; }
+  /**
+   * Return the class version. Version 1 added the sums of the
+   * variation weights.
+   */
+  static int version() { return 1; }
 };
 
 /** @endcond */
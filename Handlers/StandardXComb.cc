@@ -19,6 +19,7 @@
 #include "ThePEG/Cuts/Cuts.h"
 #include "ThePEG/PDF/PartonExtractor.h"
 #include "ThePEG/Utilities/Debug.h"
+#include "ThePEG/Utilities/Profiler.h"
 #include "ThePEG/Utilities/Maths.h"
 #include "ThePEG/PDT/ParticleData.h"
 #include "ThePEG/Persistency/PersistentOStream.h"
@@ -283,8 +284,10 @@ bool StandardXComb::willPassCuts() {
     return false;
   }
 
-  tcPDVector outdata(mePartonData().begin()+2,mePartonData().end());
-  vector<LorentzMomentum> outmomenta(meMomenta().begin()+2,meMomenta().end());
+  tcPDVector & outdata = theCutPartonData;
+  outdata.assign(mePartonData().begin()+2,mePartonData().end());
+  vector<LorentzMomentum> & outmomenta = theCutMomenta;
+  outmomenta.assign(meMomenta().begin()+2,meMomenta().end());
   Boost tocm = (meMomenta()[0]+meMomenta()[1]).findBoostToCM();
   if ( tocm.mag2() > Constants::epsilon ) {
     for ( vector<LorentzMomentum>::iterator p = outmomenta.begin();
@@ -334,13 +337,18 @@ void StandardXComb::clean() {
 }
 
 CrossSection StandardXComb::dSigDR(const double * r) {
+  if ( !prepareDependent(r) ) return ZERO;
+  return dependentCrossSection();
+}
+
+bool StandardXComb::prepareDependent(const double * r) {
 
   matrixElement()->setXComb(this);
 
   if ( !matrixElement()->apply() ) {
     subProcess(SubProPtr());
     lastCrossSection(ZERO);
-    return ZERO;
+    return false;
   }
 
   meMomenta().resize(mePartonData().size());
@@ -348,7 +356,7 @@ CrossSection StandardXComb::dSigDR(const double * r) {
   if ( !matrixElement()->generateKinematics(r) ) {
     subProcess(SubProPtr());
     lastCrossSection(ZERO);
-    return ZERO;
+    return false;
   }
 
   setIncomingPartons();
@@ -366,14 +374,24 @@ CrossSection StandardXComb::dSigDR(const double * r) {
        !matrixElement()->apply() ) {
     subProcess(SubProPtr());
     lastCrossSection(ZERO);
-    return ZERO;
+    return false;
   }
 
   lastPDFWeight(head()->lastPDFWeight());
 
+  return true;
+
+}
+
+CrossSection StandardXComb::dependentCrossSection() {
+
   matrixElement()->setKinematics();
 
-  CrossSection xsec = matrixElement()->dSigHatDR() * lastPDFWeight();
+  CrossSection xsec;
+  {
+    Profiler::Timer timer(Profiler::matrixElement, matrixElement());
+    xsec = matrixElement()->dSigHatDR() * lastPDFWeight();
+  }
 
   xsec *= cutWeight();  
 
@@ -556,7 +574,11 @@ dSigDR(const pair<double,double> ll, int nr, const double * r) {
     return ZERO;
   }
   matrixElement()->setKinematics();
-  CrossSection xsec = matrixElement()->dSigHatDR() * lastPDFWeight();
+  CrossSection xsec;
+  {
+    Profiler::Timer timer(Profiler::matrixElement, matrixElement());
+    xsec = matrixElement()->dSigHatDR() * lastPDFWeight();
+  }
   if ( xsec == ZERO ) {
     lastCrossSection(ZERO);
     return ZERO;
@@ -602,8 +624,25 @@ map<string,double> StandardXComb::generateOptionalWeights() {
   return matrixElement()->generateOptionalWeights();
 }
 
+bool StandardXComb::fillOptionalWeights(Event & event) {
+  if ( theOptionalWeightIndices.empty() ) {
+    vector<string> names = matrixElement()->optionalWeightNames();
+    if ( names.empty() ) return false;
+    for ( int i = 0, N = names.size(); i < N; ++i )
+      theOptionalWeightIndices.push_back
+	(eventHandlerPtr()->weightIndex(names[i]));
+    theOptionalWeights.resize(names.size());
+  }
+  matrixElement()->setXComb(this);
+  matrixElement()->fillOptionalWeights(theOptionalWeights);
+  for ( int i = 0, N = theOptionalWeights.size(); i < N; ++i )
+    event.variationWeight(theOptionalWeightIndices[i], theOptionalWeights[i]);
+  return true;
+}
+
 void StandardXComb::newSubProcess(bool group) {
   if ( subProcess() ) return;
+  releaseInstances();
   if ( head() && matrixElement()->wantCMS() ) {
     // first get the meMomenta in their CMS, as this may
     // not be the case
@@ -217,6 +217,20 @@ public:
    */
   double cutWeight() const { return theCutWeight; }
 
+  /**
+   * Work space for the types of the outgoing partons passed to the
+   * Cuts object for the current phase space point. It is kept
+   * between points to avoid allocations.
+   */
+  tcPDVector & cutPartonData() { return theCutPartonData; }
+
+  /**
+   * Work space for the momenta of the outgoing partons passed to the
+   * Cuts object for the current phase space point. It is kept
+   * between points to avoid allocations.
+   */
+  vector<LorentzMomentum> & cutMomenta() { return theCutMomenta; }
+
   /**
    * Reset all saved data about last generated phasespace point;
    */
@@ -247,6 +261,21 @@ public:
    */
   CrossSection dSigDR(const double * r);
 
+  /**
+   * The first part of dSigDR(const double *): generate the kinematics
+   * and check the cuts. Returns false (with the cross section set to
+   * zero) if the cross section vanishes.
+   */
+  bool prepareDependent(const double * r);
+
+  /**
+   * The second part of dSigDR(const double *): calculate the cross
+   * section in the point set up by prepareDependent(). This only
+   * involves the matrix element of this XComb and may be called
+   * concurrently for XCombs with different matrix elements.
+   */
+  CrossSection dependentCrossSection();
+
   /**
    * If variations are available for the subprocess handled, generate
    * and return a map of optional weights to be included for the
@@ -255,6 +284,17 @@ public:
    */
   virtual map<string,double> generateOptionalWeights();
 
+  /**
+   * If the matrix element provides MEBase::optionalWeightNames(), set
+   * the corresponding variation weights of \a event, indexed as
+   * given by EventHandler::weightNames(), and return true. Other
+   * variation weights of the event are left untouched. The mapping
+   * of the names to indices is only done once. Otherwise return
+   * false, in which case generateOptionalWeights() should be used
+   * instead.
+   */
+  bool fillOptionalWeights(Event & event);
+
   /**
    * Return the PDF weight used in the last call to dSigDR
    */
@@ -382,6 +422,12 @@ public:
    */
   void meInfo(const DVector & info) { theMEInfo = info; }
 
+  /**
+   * Set information saved by the matrix element given as a list of
+   * values, reusing the storage of the previous phase space point.
+   */
+  void meInfo(std::initializer_list<double> info) { theMEInfo.assign(info); }
+
   /**
    * Return the random numbers used to generate the
    * last phase space point, if the matrix element
@@ -630,6 +676,17 @@ private:
    */
   double theLastPDFWeight;
 
+  /**
+   * The indices in EventHandler::weightNames() of the
+   * MEBase::optionalWeightNames() of the matrix element.
+   */
+  vector<size_t> theOptionalWeightIndices;
+
+  /**
+   * The optional weights as given by the matrix element.
+   */
+  DVector theOptionalWeights;
+
   /**
    * The cross section calculated in the last call to dSigDR
    */
@@ -707,6 +764,18 @@ private:
    */
   double theCutWeight;
 
+  /**
+   * Work space for the types of the outgoing partons passed to the
+   * Cuts object.
+   */
+  tcPDVector theCutPartonData;
+
+  /**
+   * Work space for the momenta of the outgoing partons passed to the
+   * Cuts object.
+   */
+  vector<LorentzMomentum> theCutMomenta;
+
   /**
    * True if a reshuffling is required when constructing the hard
    * subprocess.
@@ -19,6 +19,8 @@
 #include "ThePEG/Cuts/Cuts.h"
 #include "ThePEG/PDF/PartonExtractor.h"
 #include "ThePEG/Utilities/Debug.h"
+#include "ThePEG/Utilities/Profiler.h"
+#include "ThePEG/Utilities/TaskPool.h"
 #include "ThePEG/Utilities/Maths.h"
 #include "ThePEG/PDT/ParticleData.h"
 #include "ThePEG/Persistency/PersistentOStream.h"
@@ -247,7 +249,11 @@ CrossSection StdXCombGroup::dSigDR(const pair<double,double> ll, int nr, const d
     return ZERO;
   }
   matrixElement()->setKinematics();
-  CrossSection xsec = matrixElement()->dSigHatDR() * lastPDFWeight();
+  CrossSection xsec;
+  {
+    Profiler::Timer timer(Profiler::matrixElement, matrixElement());
+    xsec = matrixElement()->dSigHatDR() * lastPDFWeight();
+  }
 
   bool noHeadPass = !willPassCuts() || xsec == ZERO;
   if ( noHeadPass ) {
@@ -266,11 +272,17 @@ CrossSection StdXCombGroup::dSigDR(const pair<double,double> ll, int nr, const d
 
   vector<tStdXCombPtr> activeXCombs;
 
+  bool parallel = theMEGroup->dependentThreads() > 1;
+  if ( parallel ) parallelDependentDSigDR(r, noHeadPass);
+
   for ( vector<StdXCombPtr>::const_iterator dep = theDependent.begin();
 	dep != theDependent.end(); ++dep ) {
     if ( noHeadPass && (**dep).matrixElement()->headCuts() )
       continue;
-    depxsec += (**dep).dSigDR(r + theMEGroup->dependentOffset((**dep).matrixElement()));
+    if ( parallel )
+      depxsec += (**dep).lastCrossSection();
+    else
+      depxsec += (**dep).dSigDR(r + theMEGroup->dependentOffset((**dep).matrixElement()));
     if ( theMEGroup->groupReweighted() )
       activeXCombs.push_back(*dep);
   }
@@ -332,6 +344,44 @@ CrossSection StdXCombGroup::dSigDR(const pair<double,double> ll, int nr, const d
 
 }
 
+void StdXCombGroup::parallelDependentDSigDR(const double * r,
+					    bool noHeadPass) {
+  if ( theDependentTasks.empty() ) {
+    map<tcMEPtr,int> task;
+    for ( int i = 0, N = theDependent.size(); i < N; ++i ) {
+      tcMEPtr me = theDependent[i]->matrixElement();
+      if ( task.find(me) == task.end() ) {
+	task[me] = theDependentTasks.size();
+	theDependentTasks.push_back(vector<int>());
+      }
+      theDependentTasks[task[me]].push_back(i);
+    }
+  }
+
+  // Everything but the evaluation of the matrix elements may touch
+  // objects shared between the dependent XCombs, such as the cuts
+  // and the reference counts of particle data objects.
+  static std::mutex prepareMutex;
+  TaskPool::instance().run(theDependentTasks.size(), [&](int t) {
+      const vector<int> & task = theDependentTasks[t];
+      for ( int i = 0, N = task.size(); i < N; ++i ) {
+	StandardXComb & dep = *theDependent[task[i]];
+	if ( noHeadPass && dep.matrixElement()->headCuts() ) continue;
+	bool ok;
+	{
+	  std::lock_guard<std::mutex> lock(prepareMutex);
+	  ok = dep.prepareDependent
+	    (r + theMEGroup->dependentOffset(dep.matrixElement()));
+	  // Releasing the sub-process may touch shared reference
+	  // counts, so it is done here rather than in
+	  // dependentCrossSection().
+	  dep.subProcess(SubProPtr());
+	}
+	if ( ok ) dep.dependentCrossSection();
+      }
+    });
+}
+
 void StdXCombGroup::newSubProcess(bool) {
 
   StandardXComb::newSubProcess(theMEGroup->subProcessGroups());
@@ -109,6 +109,20 @@ public:
    */
   void lastHeadCrossSection(CrossSection xs) { theLastHeadCrossSection = xs; }
 
+protected:
+
+  /**
+   * Calculate the cross sections of the dependent XCombs for the
+   * random numbers \a r using the TaskPool, skipping those requiring
+   * the head cuts if \a noHeadPass is true. The dependent XCombs are
+   * grouped by matrix element and each group is handled in a
+   * separate task, where the kinematics is generated and the cuts
+   * are checked one task at the time, while the matrix elements are
+   * evaluated concurrently. The results are available from the
+   * lastCrossSection() of each dependent XComb.
+   */
+  void parallelDependentDSigDR(const double * r, bool noHeadPass);
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -149,6 +163,12 @@ private:
    */
   CrossSection theLastHeadCrossSection;
 
+  /**
+   * The indices of the dependent XCombs grouped by matrix element,
+   * used by parallelDependentDSigDR().
+   */
+  vector< vector<int> > theDependentTasks;
+
 private:
 
   /**
@@ -31,6 +31,7 @@
 #include "ThePEG/Handlers/LuminosityFunction.h"
 #include "ThePEG/Handlers/CascadeHandler.h"
 #include "ThePEG/Repository/EventGenerator.h"
+#include <typeinfo>
 
 using namespace ThePEG;
 
@@ -39,7 +40,8 @@ XComb::XComb()
     theLastP1P2(make_pair(1.0, 1.0)), theLastL1L2(make_pair(1.0, 1.0)),
     theLastX1X2(make_pair(1.0, 1.0)), theLastE1E2(make_pair(0.0, 0.0)),
     theLastScale(ZERO), theLastCentralScale(ZERO), theLastShowerScale(ZERO),
-    theLastAlphaS(-1.0), theLastAlphaEM(-1.0), theMaxEnergy(ZERO) {}
+    theLastAlphaS(-1.0), theLastAlphaEM(-1.0), theMaxEnergy(ZERO),
+    theReuseInstances(false) {}
 
 XComb::
 XComb(Energy newMaxEnergy, const cPDPair & inc, tEHPtr newEventHandler,
@@ -52,7 +54,7 @@ XComb(Energy newMaxEnergy, const cPDPair & inc, tEHPtr newEventHandler,
     theLastL1L2(make_pair(1.0, 1.0)), theLastX1X2(make_pair(1.0, 1.0)),
     theLastE1E2(make_pair(0.0, 0.0)), theLastScale(ZERO), theLastCentralScale(ZERO),
     theLastShowerScale(ZERO), theLastAlphaS(-1.0), theLastAlphaEM(-1.0),
-  theMaxEnergy(newMaxEnergy) {
+  theMaxEnergy(newMaxEnergy), theReuseInstances(false) {
   thePartons = cPDPair(partonBins().first->parton(),
 		       partonBins().second->parton());
   thePartonBinInstances.first =
@@ -82,10 +84,47 @@ void XComb::prepare(const PPair & inc) {
   clean();
   createPartonBinInstances();
   theLastParticles = inc;
+  theReuseInstances = false;
   pExtractor()->select(this);
   pExtractor()->prepare(partonBinInstances());
 }
 
+void XComb::prepare(Energy2 s) {
+  PPair inc = lastParticles();
+  PBIPair pbis = partonBinInstances();
+  // The instances are only recycled directly if the parton extractor
+  // is a plain PartonExtractor, as sub-classes may have overridden
+  // PartonExtractor::prepare().
+  if ( !theReuseInstances || !inc.first || !inc.second ||
+       !pbis.first || !pbis.second ||
+       typeid(*pExtractor()) != typeid(PartonExtractor) ) {
+    inc = make_pair(particles().first->produceParticle(),
+		    particles().second->produceParticle());
+    SimplePhaseSpace::CMS(inc, s);
+    prepare(inc);
+    theReuseInstances = true;
+    return;
+  }
+
+  // Keep the instances (and the nodes of the parton bin instance map)
+  // of the previous phase space point through the call to clean() and
+  // reset them as if they had just been created.
+  PartonBinInstanceMap pbimap;
+  pbimap.swap(thePartonBinInstanceMap);
+  clean();
+  thePartonBinInstanceMap.swap(pbimap);
+  thePartonBinInstances = pbis;
+  theLastParticles = inc;
+  inc.first->set5Momentum(Lorentz5Momentum(inc.first->data().generateMass(),
+					   Momentum3()));
+  inc.second->set5Momentum(Lorentz5Momentum(inc.second->data().generateMass(),
+					    Momentum3()));
+  SimplePhaseSpace::CMS(inc, s);
+  pExtractor()->select(this);
+  pbis.first->recycle();
+  pbis.second->recycle();
+}
+
 void XComb::subProcess(tSubProPtr sp) {
   theSub = sp;
 }
@@ -105,6 +144,7 @@ void XComb::createPartonBinInstances() {
 void XComb::setPartonBinInstances(PBIPair pbip, Energy2 scale) {
   clean();
   thePartonBinInstances = pbip;
+  releaseInstances();
   theLastParticles = PPair(pbip.first->getFirst()->parton(),
 			   pbip.second->getFirst()->parton());
   theLastPartons = PPair(pbip.first->parton(),
@@ -145,6 +145,24 @@ public:
    */
   void prepare(const PPair &);
 
+  /**
+   * Prepare this XComb for producing a sub-process with the incoming
+   * particles in their cms with total invariant mass squared \a s.
+   * Unless releaseInstances() has been called, the particle, parton
+   * and parton bin instances of the previous phase space point are
+   * reused, otherwise new ones are created. The instances are only
+   * reused if the parton extractor is a plain PartonExtractor, since
+   * PartonExtractor::prepare() is not called for them.
+   */
+  void prepare(Energy2 s);
+
+  /**
+   * Indicate that the particle, parton and parton bin instances of
+   * the last generated phase space point have been handed over to an
+   * event and must not be reused by prepare(Energy2).
+   */
+  void releaseInstances() { theReuseInstances = false; }
+
   /**
    * Return the pair of incoming particle instances.
    */
@@ -423,7 +441,10 @@ public:
   /**
    * Set information about currently generated partons.
    */
-  void resetPartonBinInstances(const PBIPair & newBins) { thePartonBinInstances = newBins; }
+  void resetPartonBinInstances(const PBIPair & newBins) {
+    thePartonBinInstances = newBins;
+    releaseInstances();
+  }
 
 public:
 
@@ -596,6 +617,13 @@ private:
    */
   map<int,AnyReference> theMeta;
 
+  /**
+   * True if the particle, parton and parton bin instances of the last
+   * phase space point were created by prepare(Energy2) and may be
+   * reused for the next one.
+   */
+  bool theReuseInstances;
+
 private:
 
   /**
@@ -137,6 +137,14 @@ public:
     return IVector();
   }
 
+  /**
+   * Return true if setting this interface calls a member function of
+   * the object rather than only assigning a member variable. Such a
+   * function may have arbitrary side effects, including changing
+   * references to other objects.
+   */
+  virtual bool hasSetFunction() const { return false; }
+
   /**
    * Return the description of this interface.
    */
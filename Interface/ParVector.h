@@ -951,6 +951,11 @@ public:
    */
   void setSetFunction(SetFn sf) { theSetFn = sf; }
 
+  /**
+   * Return true if a member function is used by tset().
+   */
+  virtual bool hasSetFunction() const { return theSetFn != 0; }
+
   /**
    * Give a pointer to a member function to be used by tinsert().
    */
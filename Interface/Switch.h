@@ -351,6 +351,11 @@ public:
    */
   void setSetFunction(SetFn sf) { theSetFn = sf; }
 
+  /**
+   * Return true if a member function is used by 'set()'.
+   */
+  virtual bool hasSetFunction() const { return theSetFn != 0; }
+
   /**
    * Give a pointer to a member function to be used by 'get()'.
    */
@@ -638,6 +638,21 @@ void LesHouchesFileReader::open() {
   string central = "central";
   if (theIncludeCentral) optionalWeightsNames.push_back(central);
 
+  // index the weight information by the weight id without quotes to
+  // avoid searching through all of them for each weight of each event
+  string str_quote = "'";
+  string str_doublequote = "\"";
+  string str_newline = "\n";
+  scaleinfo.clear();
+  for (map<string,string>::const_iterator it=scalemap.begin(); it!=scalemap.end(); ++it){
+    string id = it->first;
+    erase_substr(id, str_quote);
+    erase_substr(id, str_doublequote);
+    string info = it->second;
+    erase_substr(info, str_newline);
+    scaleinfo[id] = info;
+  }
+
   //  cout << "reading init finished" << endl;
   if ( !cfile ) {
     heprup.NPRUP = -42;
@@ -812,19 +827,9 @@ bool LesHouchesFileReader::doReadEvent() {
     string id_1 = it->first;
     erase_substr(id_1, str_quote);
     erase_substr(id_1, str_doublequote);
-    for (map<string,string>::const_iterator it2=scalemap.begin(); it2!=scalemap.end(); ++it2){
-      //find the scale id in the scale information and add this information
-      string id_2 = it2->first;
-      erase_substr(id_2, str_quote);
-      erase_substr(id_2, str_doublequote);
-      if(id_1==id_2) {
-        string info = it2->second;
-	string str_newline = "\n";
-	erase_substr(info, str_newline);
-	//set the optional weights
-	optionalWeights[info] = it->second;
-      }
-    }
+    map<string,string>::const_iterator it2 = scaleinfo.find(id_1);
+    //set the optional weights
+    if ( it2 != scaleinfo.end() ) optionalWeights[it2->second] = it->second;
   }
   /* additionally, we set the "central" scale
    * this is actually the default event weight 
@@ -259,6 +259,12 @@ private:
    */
   map<string,string> scalemap;
 
+  /**
+   * The information in scalemap indexed by the weight id stripped of
+   * quotes, as used when reading the weights of each event.
+   */
+  map<string,string> scaleinfo;
+
   /**
    * Temporary holder for optional weights
    */
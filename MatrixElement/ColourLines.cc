@@ -17,9 +17,34 @@
 #include "ThePEG/EventRecord/MultiColour.h"
 #include "ThePEG/EventRecord/Particle.h"
 #include "ThePEG/Utilities/StringUtils.h"
+#include <deque>
+#include <mutex>
 
 using namespace ThePEG;
 
+namespace {
+
+/**
+ * The global table of interned ColourLines objects. A deque is used
+ * so that references to the objects stay valid when new ones are
+ * added.
+ */
+struct InternedColourLines {
+  /** The interned objects. */
+  std::deque<ColourLines> lines;
+  /** The index of the object corresponding to a given string. */
+  map<string,int> index;
+  /** Protects the table when new objects are added. */
+  std::mutex mutex;
+};
+
+InternedColourLines & internedColourLines() {
+  static InternedColourLines table;
+  return table;
+}
+
+}
+
 ColourLines::ColourLines(string s) {
   reset(s); 
 } 
@@ -57,6 +82,19 @@ void ColourLines::reset(string s) {
   }
 }
 
+int ColourLines::intern(string s) {
+  InternedColourLines & table = internedColourLines();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  map<string,int>::iterator it = table.index.find(s);
+  if ( it != table.index.end() ) return it->second;
+  table.lines.push_back(ColourLines(s));
+  return table.index[s] = table.lines.size() - 1;
+}
+
+const ColourLines & ColourLines::interned(int i) {
+  return internedColourLines().lines[i];
+}
+
 void ColourLines::connect(const tPVector & partons) const {
   VertexVector sinks;
   VertexVector sources;
@@ -66,6 +66,26 @@ public:
    */ 
   void reset(string s); 
 
+public:
+
+  /**
+   * Return the index of a ColourLines object constructed from the
+   * string \a s in a global table, where it is only parsed the first
+   * time the same string is given. Typically used to initialize
+   * function-local static variables in matrix element classes, which
+   * may then refer to their colour geometries by index (see
+   * MEBase::colourGeometryTable()). New entries should only be added
+   * before or in between the generation of events, not concurrently
+   * with calls to interned().
+   */
+  static int intern(string s);
+
+  /**
+   * Return the ColourLines object with the given index as returned
+   * from intern().
+   */
+  static const ColourLines & interned(int i);
+
 public:
 
   /**
@@ -116,10 +116,12 @@ bool ME2to2Base::generateKinematics(const double * r) {
   meMomenta()[2].rescaleEnergy();
   meMomenta()[3].rescaleEnergy();
 
-  vector<LorentzMomentum> out(2);
+  vector<LorentzMomentum> & out = lastXCombPtr()->cutMomenta();
+  out.resize(2);
   out[0] = meMomenta()[2];
   out[1] = meMomenta()[3];
-  tcPDVector tout(2);
+  tcPDVector & tout = lastXCombPtr()->cutPartonData();
+  tout.resize(2);
   tout[0] = mePartonData()[2];
   tout[1] = mePartonData()[3];
   if ( !lastCuts().passCuts(tout, out, mePartonData()[0], mePartonData()[1]) )
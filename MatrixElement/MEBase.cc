@@ -146,12 +146,82 @@ MEBase::DiagramIndex MEBase::diagram(const DiagramVector & dv) const {
   return DiagramIndex(rnd(dv.size()));
 }
 
+Selector<const ColourLines *>
+MEBase::colourGeometries(tcDiagPtr diag) const {
+  vector<int> geometries(maxColourGeometries);
+  vector<double> weights(maxColourGeometries);
+  int n = colourGeometryTable(diag, geometries.data(), weights.data(),
+			      maxColourGeometries);
+  if ( n > maxColourGeometries ) {
+    geometries.resize(n);
+    weights.resize(n);
+    n = colourGeometryTable(diag, geometries.data(), weights.data(), n);
+  }
+  if ( n < 0 ) throw Exception()
+    << "The matrix element '" << name() << "' does not implement "
+    << "colourGeometries() nor colourGeometryTable()."
+    << Exception::abortnow;
+  Selector<const ColourLines *> sel;
+  for ( int i = 0; i < n; ++i )
+    sel.insert(weights[i], &ColourLines::interned(geometries[i]));
+  return sel;
+}
+
+int MEBase::colourGeometryTable(tcDiagPtr, int *, double *, int) const {
+  return -1;
+}
+
 const ColourLines & MEBase::
 selectColourGeometry(tcDiagPtr diag) const {
-  Selector<const ColourLines *> sel = colourGeometries(diag);
-  if ( sel.size() == 1 )
-    return *sel.begin()->second;
-  return *sel.select(rnd());
+  int geometries[maxColourGeometries];
+  double weights[maxColourGeometries];
+  int n = hasColourGeometryTable()?
+    colourGeometryTable(diag, geometries, weights, maxColourGeometries): -1;
+  if ( n > maxColourGeometries ) {
+    vector<int> g(n);
+    vector<double> w(n);
+    n = colourGeometryTable(diag, g.data(), w.data(), n);
+    return selectFromColourGeometryTable(g.data(), w.data(), n);
+  }
+  if ( n < 0 ) {
+    Selector<const ColourLines *> sel = colourGeometries(diag);
+    if ( sel.size() == 1 )
+      return *sel.begin()->second;
+    return *sel.select(rnd());
+  }
+  return selectFromColourGeometryTable(geometries, weights, n);
+}
+
+const ColourLines & MEBase::
+selectFromColourGeometryTable(const int * geometries, double * weights,
+			      int n) const {
+  // Select in the same way as a Selector would, so that the same
+  // random numbers give the same geometries. Geometries with
+  // non-positive weights are never selected.
+  int last = -1;
+  int npos = 0;
+  double sum = 0.0;
+  for ( int i = 0; i < n; ++i ) {
+    if ( sum + weights[i] <= sum ) {
+      weights[i] = sum;
+      continue;
+    }
+    sum += weights[i];
+    weights[i] = sum;
+    last = i;
+    ++npos;
+  }
+  if ( npos == 1 ) return ColourLines::interned(geometries[last]);
+  if ( npos == 0 ) throw range_error("No colour geometry with positive weight "
+				     "in MEBase::selectColourGeometry.");
+  double r = rnd()*sum;
+  double prev = 0.0;
+  for ( int i = 0; i < last; ++i ) {
+    if ( weights[i] <= prev ) continue;
+    if ( weights[i] > r ) return ColourLines::interned(geometries[i]);
+    prev = weights[i];
+  }
+  return ColourLines::interned(geometries[last]);
 }
 
 int MEBase::nDim() const {
@@ -234,6 +304,10 @@ void MEBase::meInfo(const DVector & info) const {
   lastXCombPtr()->meInfo(info);
 }
 
+void MEBase::meInfo(std::initializer_list<double> info) const {
+  lastXCombPtr()->meInfo(info);
+}
+
 double MEBase::alphaS() const {
   return SM().alphaS(scale());
 }
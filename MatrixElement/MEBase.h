@@ -58,7 +58,12 @@ namespace ThePEG {
  * colourGeometries() should return a Selector with the possible
  * ColourLines objects weighted by their relative probabilities given
  * the information set by the last call to setKinematics(...) or
- * generateKinematics(...).
+ * generateKinematics(...). Alternatively, and preferably since no
+ * Selector need to be constructed for each event,
+ * colourGeometryTable() may be overridden to give the indices of
+ * interned ColourLines objects (see ColourLines::intern()) and their
+ * relative probabilities, in which case hasColourGeometryTable() must
+ * be overridden to return true.
  *
  * There are other virtula functions which may be overridden as listed
  * below.
@@ -220,6 +225,27 @@ public:
     return map<string,double>();
   }
 
+  /**
+   * If the variations generated for the subprocess handled are always
+   * the same, return their names here. The weights are then generated
+   * with fillOptionalWeights(vector<double> &) rather than with
+   * generateOptionalWeights(), avoiding building a map of names for
+   * each event.
+   */
+  virtual vector<string> optionalWeightNames() const {
+    return vector<string>();
+  }
+
+  /**
+   * Set the optional weights to be included for the event in \a
+   * weights, which has the same size and order as
+   * optionalWeightNames(). Only called if optionalWeightNames() is
+   * not empty.
+   */
+  virtual void fillOptionalWeights(vector<double> & weights) {
+    weights.assign(weights.size(), 0.0);
+  }
+
   /**
    * Return true, if this matrix element will generate momenta for the
    * incoming partons itself.  The matrix element is required to store
@@ -286,17 +312,57 @@ public:
     return theDiagrams;
   }
 
+  /**
+   * The size of the arrays given to colourGeometryTable() by
+   * selectColourGeometry(). Larger arrays are only allocated if a
+   * diagram has more possible colour geometries.
+   */
+  static const int maxColourGeometries = 16;
+
   /**
    * Return a Selector with possible colour geometries for the selected
-   * diagram weighted by their relative probabilities.
+   * diagram weighted by their relative probabilities. The default
+   * version constructs the Selector from colourGeometryTable(). Either
+   * this function or colourGeometryTable() must be overridden. A
+   * sub-class of a class implementing colourGeometryTable() which
+   * overrides this function must also override
+   * hasColourGeometryTable() to return false, otherwise
+   * selectColourGeometry() will not use it.
    */
   virtual Selector<const ColourLines *>
-  colourGeometries(tcDiagPtr diag) const = 0;
+  colourGeometries(tcDiagPtr diag) const;
+
+  /**
+   * Fill \a geometries with the indices of the possible colour
+   * geometries for the selected diagram, as given by
+   * ColourLines::intern(), and \a weights with their relative
+   * probabilities. The arrays have room for \a capacity elements.
+   * Return the number of geometries, or -1 if the table is not
+   * available, in which case colourGeometries(tcDiagPtr) is used
+   * instead. If there are more than \a capacity geometries the arrays
+   * must be left untouched, and the function is called again with
+   * arrays of the returned size. The default version returns -1.
+   * The table is only used by selectColourGeometry() if
+   * hasColourGeometryTable() returns true.
+   */
+  virtual int colourGeometryTable(tcDiagPtr diag, int * geometries,
+				  double * weights, int capacity) const;
+
+  /**
+   * Return true if selectColourGeometry() should use
+   * colourGeometryTable() rather than colourGeometries(tcDiagPtr).
+   * Must be overridden to return true by sub-classes implementing
+   * colourGeometryTable(), and to return false again by their
+   * sub-classes overriding colourGeometries(tcDiagPtr).
+   */
+  virtual bool hasColourGeometryTable() const { return false; }
 
   /**
    * Select a ColpurLines geometry. The default version returns a
-   * colour geometry selected among the ones returned from
-   * colourGeometries(tcDiagPtr).
+   * colour geometry selected among the ones given by
+   * colourGeometryTable() if hasColourGeometryTable() returns true
+   * and the table is available, and otherwise among the ones returned
+   * from colourGeometries(tcDiagPtr).
    */
   virtual const ColourLines &
   selectColourGeometry(tcDiagPtr diag) const;
@@ -433,6 +499,13 @@ public:
    */
   void meInfo(const DVector & info) const;
 
+  /**
+   * Save information obtained in the calculation of the cross
+   * section given as a list of values, without creating a temporary
+   * vector.
+   */
+  void meInfo(std::initializer_list<double> info) const;
+
   /**
    * If this matrix element is to be used together with others for
    * CKKW reweighting and veto, this should give the multiplicity of
@@ -627,6 +700,15 @@ private:
 
 private:
 
+  /**
+   * Select one of the \a n colour geometries in \a geometries
+   * according to the relative probabilities in \a weights, which are
+   * overwritten.
+   */
+  const ColourLines &
+  selectFromColourGeometryTable(const int * geometries,
+				double * weights, int n) const;
+
   /**
    * Describe an abstract base class with persistent data.
    */
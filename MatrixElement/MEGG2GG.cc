@@ -37,42 +37,48 @@ double MEGG2GG::me2() const {
 			 (colC1() + colC2())*Kfac())/16.0;
 }
 
-Selector<const ColourLines *>
-MEGG2GG::colourGeometries(tcDiagPtr diag) const {
-  static ColourLines ctST("1 -2 -3, 3 5, -5 2 4, -4 -1");
-  static ColourLines ctTS("1 4, -4 -2 5, -5 -3, 3 2 -1");
-  static ColourLines ctUT("1 -2 5, -5 -3, 3 2 4, -4 -1");
-  static ColourLines ctTU("1 4, -4 -2 -3, 3 5, -5 2 -1");
-
-  static ColourLines cuSU("1 -2 -3, 3 4, -4 2 5, -5 -1");
-  static ColourLines cuUS("1 5, -5 -2 4, -4 -3, 3 2 -1");
-  static ColourLines cuTU("1 -2 4, -4 -3, 3 2 5, -5 -1");
-  static ColourLines cuUT("1 5, -5 -2 -3, 3 4, -4 2 -1");
-
-  static ColourLines csTS("1 3 4, -4 5, -5 -3 -2, 2 -1");
-  static ColourLines csST("1 -2, 2 3 5, -5 4, -4 -3 -1");
-  static ColourLines csUS("1 3 5, -5 4, -4 -3 -2, 2 -1");
-  static ColourLines csSU("1 -2, 2 3 4, -4 5, -5 -3 -1");
-
-  
-  Selector<const ColourLines *> sel;
+int MEGG2GG::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
+  static const int ctST = ColourLines::intern("1 -2 -3, 3 5, -5 2 4, -4 -1");
+  static const int ctTS = ColourLines::intern("1 4, -4 -2 5, -5 -3, 3 2 -1");
+  static const int ctUT = ColourLines::intern("1 -2 5, -5 -3, 3 2 4, -4 -1");
+  static const int ctTU = ColourLines::intern("1 4, -4 -2 -3, 3 5, -5 2 -1");
+
+  static const int cuSU = ColourLines::intern("1 -2 -3, 3 4, -4 2 5, -5 -1");
+  static const int cuUS = ColourLines::intern("1 5, -5 -2 4, -4 -3, 3 2 -1");
+  static const int cuTU = ColourLines::intern("1 -2 4, -4 -3, 3 2 5, -5 -1");
+  static const int cuUT = ColourLines::intern("1 5, -5 -2 -3, 3 4, -4 2 -1");
+
+  static const int csTS = ColourLines::intern("1 3 4, -4 5, -5 -3 -2, 2 -1");
+  static const int csST = ColourLines::intern("1 -2, 2 3 5, -5 4, -4 -3 -1");
+  static const int csUS = ColourLines::intern("1 3 5, -5 4, -4 -3 -2, 2 -1");
+  static const int csSU = ColourLines::intern("1 -2, 2 3 4, -4 5, -5 -3 -1");
+
+  if ( capacity < 4 ) return 4;
+
   if ( diag->id() == -1 ) {
-    sel.insert(colA1(), &ctST);
-    sel.insert(colA1(), &ctTS);
-    sel.insert(colC2(), &ctUT);
-    sel.insert(colC2(), &ctTU);
+    geometries[0] = ctST;
+    geometries[1] = ctTS;
+    geometries[2] = ctUT;
+    geometries[3] = ctTU;
+    weights[0] = weights[1] = colA1();
+    weights[2] = weights[3] = colC2();
   } else if ( diag->id() == -2 ) {
-    sel.insert(colB2(), &cuSU);
-    sel.insert(colB2(), &cuUS);
-    sel.insert(colC1(), &cuTU);
-    sel.insert(colC1(), &cuUT);
+    geometries[0] = cuSU;
+    geometries[1] = cuUS;
+    geometries[2] = cuTU;
+    geometries[3] = cuUT;
+    weights[0] = weights[1] = colB2();
+    weights[2] = weights[3] = colC1();
   } else {
-    sel.insert(colA2(), &csST);
-    sel.insert(colA2(), &csTS);
-    sel.insert(colB1(), &csSU);
-    sel.insert(colB1(), &csUS);
+    geometries[0] = csST;
+    geometries[1] = csTS;
+    geometries[2] = csSU;
+    geometries[3] = csUS;
+    weights[0] = weights[1] = colA2();
+    weights[2] = weights[3] = colB1();
   }
-  return sel;
+  return 4;
 }
 
 Selector<MEGG2GG::DiagramIndex>
@@ -39,18 +39,17 @@ double MEGG2QQ::me2() const {
   return comfac()*(colA() + colB())*KfacA()/12.0;
 }
 
-Selector<const ColourLines *>
-MEGG2QQ::colourGeometries(tcDiagPtr diag) const {
+int MEGG2QQ::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines ctST("1 4, -5 -3, 3 2 -1");
-  static ColourLines cuSU("1 -2 -3, 3 4, -5 -1");
+  static const int ctST = ColourLines::intern("1 4, -5 -3, 3 2 -1");
+  static const int cuSU = ColourLines::intern("1 -2 -3, 3 4, -5 -1");
 
-  Selector<const ColourLines *> sel;
-  if ( diag->id() == -1 )
-    sel.insert(1.0, &ctST);
-  else
-    sel.insert(1.0, &cuSU);
-  return sel;
+  if ( capacity < 1 ) return 1;
+
+  geometries[0] = diag->id() == -1? ctST: cuSU;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEGG2QQ::DiagramIndex>
@@ -18,16 +18,18 @@
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Interface/Reference.h"
 #include "ThePEG/Interface/RefVector.h"
+#include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Utilities/Rebinder.h"
 #include "ThePEG/PDF/PartonBin.h"
 #include "ThePEG/PDF/PartonExtractor.h"
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Handlers/StdXCombGroup.h"
+#include "ThePEG/Utilities/TaskPool.h"
 
 using namespace ThePEG;
 
 MEGroup::MEGroup()
-  : theDependent(), theNDimMap(), theNDim(0) {}
+  : theDependent(), theNDimMap(), theNDim(0), theDependentThreads(1) {}
 
 MEGroup::~MEGroup() {}
 
@@ -65,6 +67,8 @@ void MEGroup::doinitrun() {
   for ( MEVector::iterator me = theDependent.begin();
 	me != theDependent.end(); ++me )
     (**me).initrun();
+  if ( theDependentThreads > 1 )
+    TaskPool::instance().reserve(theDependentThreads);
 }
 
 void MEGroup::rebind(const TranslationMap & trans) {
@@ -183,11 +187,14 @@ void MEGroup::clearKinematics() {
 }
 
 void MEGroup::persistentOutput(PersistentOStream & os) const {
-  os << theHead << theDependent << theNDimMap << theNDim;
+  os << theHead << theDependent << theNDimMap << theNDim
+     << theDependentThreads;
 }
 
-void MEGroup::persistentInput(PersistentIStream & is, int) {
+void MEGroup::persistentInput(PersistentIStream & is, int version) {
   is >> theHead >> theDependent >> theNDimMap >> theNDim;
+  if ( version >= 1 ) is >> theDependentThreads;
+  else theDependentThreads = 1;
 }
 
 AbstractClassDescription<MEGroup> MEGroup::initMEGroup;
@@ -210,5 +217,16 @@ void MEGroup::Init() {
      "The vector of dependent matrix elements in this matrix element group.",
      &MEGroup::theDependent, -1, false, false, true, false, false);
 
+  static Parameter<MEGroup,int> interfaceDependentThreads
+    ("DependentThreads",
+     "The number of threads used to calculate the cross sections of the "
+     "dependent matrix elements for each phase space point. If larger "
+     "than one, the dependent matrix elements are evaluated concurrently, "
+     "using a pool of threads shared by all matrix element groups. Only "
+     "use this if the dependent matrix elements do not share any state "
+     "in their dSigHatDR() functions (e.g. a common underlying matrix "
+     "element) and do not use the random number generator there.",
+     &MEGroup::theDependentThreads, 1, 1, 256, true, false, Interface::limited);
+
 }
 
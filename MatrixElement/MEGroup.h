@@ -207,6 +207,22 @@ public:
   virtual Selector<const ColourLines *>
   colourGeometries(tcDiagPtr diag) const { return head()->colourGeometries(diag); }
 
+  /**
+   * Give the indices of the possible colour geometries for the
+   * selected diagram and their relative probabilities.
+   */
+  virtual int colourGeometryTable(tcDiagPtr diag, int * geometries,
+				  double * weights, int capacity) const {
+    return head()->colourGeometryTable(diag, geometries, weights, capacity);
+  }
+
+  /**
+   * Return true if the head matrix element uses colourGeometryTable().
+   */
+  virtual bool hasColourGeometryTable() const {
+    return head()->hasColourGeometryTable();
+  }
+
   /**
    * Select a ColpurLines geometry. The default version returns a
    * colour geometry selected among the ones returned from
@@ -322,6 +338,13 @@ public:
    */
   int dependentOffset(tMEPtr dep) const;
 
+  /**
+   * The number of threads used to calculate the cross sections of
+   * the dependent matrix elements for each phase space point. If
+   * larger than one, StdXCombGroup::parallelDependentDSigDR() is used.
+   */
+  int dependentThreads() const { return theDependentThreads; }
+
   /**
    * For the given event generation setup return an xcomb object
    * appropriate to this matrix element.
@@ -479,6 +502,12 @@ private:
    */
   int theNDim;
 
+  /**
+   * The number of threads used to calculate the cross sections of
+   * the dependent matrix elements.
+   */
+  int theDependentThreads;
+
 private:
 
   /**
@@ -518,6 +547,9 @@ template <>
 struct ClassTraits<MEGroup>: public ClassTraitsBase<MEGroup> {
   /** Return the class name. */
   static string className() { return "ThePEG::MEGroup"; }
+  /** Return the class version. Version 1 added the number of threads
+   *  used for the dependent matrix elements. */
+  static int version() { return 1; }
 };
 
 /** @endcond */
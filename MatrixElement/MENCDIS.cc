@@ -94,8 +94,7 @@ double MENCDIS::me2() const {
       SM().ae()*SM().ad()*SM().vd() ) / sqr((-tHat() + mZ2) * C);
   }
 
-  DVector save;
-  meInfo(save << lastG << lastZ);
+  meInfo({lastG, lastZ});
   return (lastG + lastIntr + lastZ) * sqr(SM().alphaEM(scale())) *
     32.0 * sqr(Constants::pi);
 }
@@ -114,18 +113,17 @@ MENCDIS::diagrams(const DiagramVector & diags) const {
   return sel;
 }
 
-Selector<const ColourLines *>
-MENCDIS::colourGeometries(tcDiagPtr diag) const {
+int MENCDIS::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines c("1 4");
-  static ColourLines cb("-1 -4");
+  static const int c = ColourLines::intern("1 4");
+  static const int cb = ColourLines::intern("-1 -4");
 
-  Selector<const ColourLines *> sel;
-  if ( diag->partons()[0]->id() > 0 )
-    sel.insert(1.0, &c);
-  else
-    sel.insert(1.0, &cb);
-  return sel;
+  if ( capacity < 1 ) return 1;
+
+  geometries[0] = diag->partons()[0]->id() > 0? c: cb;
+  weights[0] = 1.0;
+  return 1;
 }
 
 IBPtr MENCDIS::clone() const {
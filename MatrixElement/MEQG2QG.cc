@@ -43,36 +43,32 @@ double MEQG2QG::me2() const {
 		       (colB1() + colB2())*Kfac())/9.0;
 }
 
-Selector<const ColourLines *>
-MEQG2QG::colourGeometries(tcDiagPtr diag) const {
+int MEQG2QG::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines ctST("1 -2 -3, 3 5, -5 2 4");
-  static ColourLines ctTS("-4 -2 5, -5 -3, 3 2 -1");
-  static ColourLines ctUT("1 -2 5, -5 -3, 3 4");
-  static ColourLines ctTU("-4 -3, 3 5, -5 2 -1");
-  static ColourLines cuTU("1 5, -5 2 -3, 3 4");
-  static ColourLines cuUT("-4 -3, 3 -2 5, -1 -5");
-  static ColourLines csST("1 -2, 2 3 5, -5 4");
-  static ColourLines csTS("-4 5, -5 -3 -2, 2 -1");
+  static const int ctST = ColourLines::intern("1 -2 -3, 3 5, -5 2 4");
+  static const int ctTS = ColourLines::intern("-4 -2 5, -5 -3, 3 2 -1");
+  static const int ctUT = ColourLines::intern("1 -2 5, -5 -3, 3 4");
+  static const int ctTU = ColourLines::intern("-4 -3, 3 5, -5 2 -1");
+  static const int cuTU = ColourLines::intern("1 5, -5 2 -3, 3 4");
+  static const int cuUT = ColourLines::intern("-4 -3, 3 -2 5, -1 -5");
+  static const int csST = ColourLines::intern("1 -2, 2 3 5, -5 4");
+  static const int csTS = ColourLines::intern("-4 5, -5 -3 -2, 2 -1");
 
-  Selector<const ColourLines *> sel;
   int q = diag->partons()[0]->id();
   if ( diag->id() == -1 ) {
-    if ( q > 0 ) {
-      sel.insert(colA1(), &ctST);
-      sel.insert(colB1(), &ctUT);
-    } else {
-      sel.insert(colA1(), &ctTS);
-      sel.insert(colB1(), &ctTU);
-    }
-  } else if ( diag->id() == -2 ) {
-    if ( q > 0 ) sel.insert(1.0, &cuTU);
-    else sel.insert(1.0, &cuUT);
-  } else {
-    if ( q > 0 ) sel.insert(1.0, &csST);
-    else sel.insert(1.0, &csTS);
+    if ( capacity < 2 ) return 2;
+    geometries[0] = q > 0? ctST: ctTS;
+    weights[0] = colA1();
+    geometries[1] = q > 0? ctUT: ctTU;
+    weights[1] = colB1();
+    return 2;
   }
-  return sel;
+  if ( capacity < 1 ) return 1;
+  if ( diag->id() == -2 ) geometries[0] = q > 0? cuTU: cuUT;
+  else geometries[0] = q > 0? csST: csTS;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEQG2QG::DiagramIndex>
@@ -39,18 +39,17 @@ double MEQQ2GG::me2() const {
   return comfac()*(colA() + colB())*KfacA()*16.0/27.0;
 }
 
-Selector<const ColourLines *>
-MEQQ2GG::colourGeometries(tcDiagPtr diag) const {
+int MEQQ2GG::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines ctST("1 4, -4 2 5, -5 -3");
-  static ColourLines ctSU("1 5, -5 2 4, -4 -3");
+  static const int ctST = ColourLines::intern("1 4, -4 2 5, -5 -3");
+  static const int ctSU = ColourLines::intern("1 5, -5 2 4, -4 -3");
 
-  Selector<const ColourLines *> sel;
-  if ( diag->id() == -1 )
-    sel.insert(1.0, &ctST);
-  else
-    sel.insert(1.0, &ctSU);
-  return sel;
+  if ( capacity < 1 ) return 1;
+
+  geometries[0] = diag->id() == -1? ctST: ctSU;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEQQ2GG::DiagramIndex>
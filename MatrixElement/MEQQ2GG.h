@@ -43,14 +43,24 @@ public:
   virtual void getDiagrams() const;
 
   /**
-   * Return a Selector with possible colour geometries for the selected
-   * diagram weighted by their relative probabilities.
+   * Give the possible colour geometries for the selected diagram and
+   * their relative probabilities.
    * @param diag the diagram chosen.
-   * @return the possible colour geometries weighted by their
-   * relative probabilities.
+   * @param geometries set to the indices of the possible interned
+   * colour geometries.
+   * @param weights set to the relative probabilities of the colour
+   * geometries.
+   * @param capacity the size of the \a geometries and \a weights
+   * arrays.
+   * @return the number of possible colour geometries.
    */
-  virtual Selector<const ColourLines *>
-  colourGeometries(tcDiagPtr diag) const;
+  virtual int colourGeometryTable(tcDiagPtr diag, int * geometries,
+				  double * weights, int capacity) const;
+
+  /**
+   * Return true since colourGeometryTable() is implemented.
+   */
+  virtual bool hasColourGeometryTable() const { return true; }
 
   /**
    * Get diagram selector. With the information previously supplied with the
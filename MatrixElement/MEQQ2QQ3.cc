@@ -41,24 +41,28 @@ double MEQQ2QQ::me2() const {
   return comfac()*(colA() + colB())*KfacA()/9.0;
 }
 
-Selector<const ColourLines *>
-MEQQ2QQ::colourGeometries(tcDiagPtr diag) const {
+int MEQQ2QQ::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines ctTU("1 -2 5, 2 3 4");
-  static ColourLines ctUT("-4 -3 -2, -5 2 -1");
-  static ColourLines cuTU("1 -2 4, 2 3 5");
-  static ColourLines cuUT("-5 -3 -2, -4 2 -1");
+  static const int ctTU = ColourLines::intern("1 -2 5, 2 3 4");
+  static const int ctUT = ColourLines::intern("-4 -3 -2, -5 2 -1");
+  static const int cuTU = ColourLines::intern("1 -2 4, 2 3 5");
+  static const int cuUT = ColourLines::intern("-5 -3 -2, -4 2 -1");
+
+  if ( capacity < 1 ) return 1;
 
-  Selector<const ColourLines *> sel;
   if ( diag->id() == -1 )
-    sel.insert(1.0, &ctTU);
+    geometries[0] = ctTU;
   else if ( diag->id() == -2)
-    sel.insert(1.0, &cuTU);
+    geometries[0] = cuTU;
   else if ( diag->id() == -3 )
-    sel.insert(1.0, &ctUT);
+    geometries[0] = ctUT;
   else if ( diag->id() == -4)
-    sel.insert(1.0, &cuUT);
-  return sel;
+    geometries[0] = cuUT;
+  else
+    return 0;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEQQ2QQ::DiagramIndex>
@@ -35,14 +35,16 @@ double MEQQ2qq::me2() const {
   return comfac()*colA()*KfacA()*2.0/9.0;
 }
 
-Selector<const ColourLines *>
-MEQQ2qq::colourGeometries(tcDiagPtr) const {
-  Selector<const ColourLines *> sel;
+int MEQQ2qq::colourGeometryTable(tcDiagPtr, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines csST("1 3 4, -5 -3 -2");
+  static const int csST = ColourLines::intern("1 3 4, -5 -3 -2");
 
-  sel.insert(1.0, &csST);
-  return sel;
+  if ( capacity < 1 ) return 1;
+
+  geometries[0] = csST;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEQQ2qq::DiagramIndex>
@@ -38,24 +38,28 @@ double MEQq2Qq::me2() const {
   return comfac()*colA()*KfacA()*2.0/9.0;
 }
 
-Selector<const ColourLines *>
-MEQq2Qq::colourGeometries(tcDiagPtr diag) const {
+int MEQq2Qq::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines ctUT("1 -2 5, 3 2 4");
-  static ColourLines ctST("3 2 -1, -4 -2 5");
-  static ColourLines ctTS("1 -2 -3, -5 2 4");
-  static ColourLines ctTU("-4 -2 -3, -5 2 -1");
+  static const int ctUT = ColourLines::intern("1 -2 5, 3 2 4");
+  static const int ctST = ColourLines::intern("3 2 -1, -4 -2 5");
+  static const int ctTS = ColourLines::intern("1 -2 -3, -5 2 4");
+  static const int ctTU = ColourLines::intern("-4 -2 -3, -5 2 -1");
+
+  if ( capacity < 1 ) return 1;
 
-  Selector<const ColourLines *> sel;
   if ( diag->id() == -1 )
-    sel.insert(1.0, &ctUT);
+    geometries[0] = ctUT;
   else if ( diag->id() == -2 )
-    sel.insert(1.0, &ctST);
+    geometries[0] = ctST;
   else if ( diag->id() == -3 )
-    sel.insert(1.0, &ctTS);
+    geometries[0] = ctTS;
   else if ( diag->id() == -4 )
-    sel.insert(1.0, &ctTU);
-  return sel;
+    geometries[0] = ctTU;
+  else
+    return 0;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEQq2Qq::DiagramIndex>
@@ -76,8 +76,7 @@ double MEee2gZ2qq::me2() const {
 
   double alphaS = SM().alphaS(scale());
   int Nf = SM().Nf(scale());
-  DVector save;
-  meInfo(save << lastCont << lastBW);
+  meInfo({lastCont, lastBW});
   return (lastCont + intr + lastBW)*sqr(SM().alphaEM(scale()))*
     (1.0 + alphaS/Constants::pi + (1.986-0.115*Nf)*sqr(alphaS/Constants::pi));
 }
@@ -96,14 +95,16 @@ MEee2gZ2qq::diagrams(const DiagramVector & diags) const {
   return sel;
 }
 
-Selector<const ColourLines *>
-MEee2gZ2qq::colourGeometries(tcDiagPtr) const {
+int MEee2gZ2qq::colourGeometryTable(tcDiagPtr, int * geometries,
+				    double * weights, int capacity) const {
 
-  static ColourLines c("-5 4");
+  static const int c = ColourLines::intern("-5 4");
 
-  Selector<const ColourLines *> sel;
-  sel.insert(1.0, &c);
-  return sel;
+  if ( capacity < 1 ) return 1;
+
+  geometries[0] = c;
+  weights[0] = 1.0;
+  return 1;
 }
 
 IBPtr MEee2gZ2qq::clone() const {
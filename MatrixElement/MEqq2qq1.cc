@@ -39,18 +39,17 @@ double MEqq2qq::me2() const {
   return comfac()*(colA()*Kfac() + colB()*KfacA())*2.0/9.0;
 }
 
-Selector<const ColourLines *>
-MEqq2qq::colourGeometries(tcDiagPtr diag) const {
+int MEqq2qq::colourGeometryTable(tcDiagPtr diag, int * geometries,
+				 double * weights, int capacity) const {
 
-  static ColourLines ctST("1 -2 -3, -5 2 4");
-  static ColourLines csST("1 3 4, -5 -3 -2");
+  static const int ctST = ColourLines::intern("1 -2 -3, -5 2 4");
+  static const int csST = ColourLines::intern("1 3 4, -5 -3 -2");
 
-  Selector<const ColourLines *> sel;
-  if ( diag->id() == -1 )
-    sel.insert(1.0, &ctST);
-  else
-    sel.insert(1.0, &csST);
-  return sel;
+  if ( capacity < 1 ) return 1;
+
+  geometries[0] = diag->id() == -1? ctST: csST;
+  weights[0] = 1.0;
+  return 1;
 }
 
 Selector<MEqq2qq::DiagramIndex>
@@ -25,8 +25,9 @@ using namespace ThePEG;
 
 GRVBase::GRVBase()
   : theLx(-1.0), thex(-1.0), theEps(-1.0), theRootx(-1.0),
+    theLogEps(0.0), theLogLx(0.0),
     Q2(-GeV2), theLam2(-GeV2), theMu2(-GeV2),
-    theS(-1.0), theS2(-1.0), theS3(-1.0), theRootS(-1.0),
+    theS(-1.0), theS2(-1.0), theS3(-1.0), theRootS(-1.0), theLogS(0.0),
     uvSave(-1.0), dvSave(-1.0), delSave(-1.0), udbSave(-1.0), sbSave(-1.0),
     cbSave(-1.0), bbSave(-1.0), glSave(-1.0) {}
 
@@ -53,10 +54,29 @@ double GRVBase::xfl(tcPDPtr particle, tcPDPtr parton, Energy2 partonScale,
 		    double l, Energy2) const {
   setup(l, partonScale);
   if ( S() < 0.0 ) return 0.0;
-  using namespace ParticleID;
+  return density(parton->id(), particle->id() < 0,
+		 abs(particle->id()) == ParticleID::n0);
+}
+
+void GRVBase::xfxBatch(tcPDPtr particle, const cPDVector & partons, int n,
+		       const Energy2 * partonScales, const double * x,
+		       double * xf) const {
   bool anti = particle->id() < 0;
-  bool neutron = abs(particle->id()) == n0;
-  switch ( parton->id() ) {
+  bool neutron = abs(particle->id()) == ParticleID::n0;
+  const int M = partons.size();
+  // Each flavour function is evaluated at most once per point, and
+  // the scale dependent variables are shared between consecutive
+  // points with the same scale.
+  for ( int i = 0; i < n; ++i, xf += M ) {
+    setup(-log(x[i]), partonScales[i]);
+    for ( int j = 0; j < M; ++j )
+      xf[j] = S() < 0.0? 0.0: density(partons[j]->id(), anti, neutron);
+  }
+}
+
+double GRVBase::density(long id, bool anti, bool neutron) const {
+  using namespace ParticleID;
+  switch ( id ) {
   case b:
   case bbar:
     return max(fbb(), 0.0);
@@ -106,23 +126,22 @@ double GRVBase::xfvl(tcPDPtr particle, tcPDPtr parton, Energy2 partonScale,
 
 double GRVBase::valens(double N, double ak, double bk,
 		       double a, double b, double c, double d) const {
-  return N*pow(x(), ak)*pow(eps(), d)*
-    (1.0 + a*pow(x(), bk) + x()*(b + c*sqrt(x())));
+  return N*xpow(ak)*epspow(d)*(1.0 + a*xpow(bk) + x()*(b + c*rootx()));
 }
 
 double GRVBase::
 lightsea(double al, double be, double ak, double bk,
 	 double a, double b, double c, double d, double e, double es) const {
-  return (pow(x(), ak)*(a + x()*(b + x()*c))*pow(lx(), bk) +
-	  pow(S(), al)*exp(sqrt(es*pow(S(), be)*lx()) - e))*pow(eps(), d);
+  return (xpow(ak)*(a + x()*(b + x()*c))*lxpow(bk) +
+	  Spow(al)*exp(sqrt(es*Spow(be)*lx()) - e))*epspow(d);
 }
 
 double GRVBase::
 heavysea(double sth, double al, double be, double ak, double ag,
 	 double b, double d, double e, double es) const {
   return S() <= sth? 0.0:
-    pow(S() - sth, al)*(1.0 + rootx()*ag + x()*b)*pow(eps(), d)*
-    exp(sqrt(es*pow(S(), be)*lx()) - e)/pow(lx(),ak);
+    pow(S() - sth, al)*(1.0 + rootx()*ag + x()*b)*epspow(d)*
+    exp(sqrt(es*Spow(be)*lx()) - e)/lxpow(ak);
 }
 
 void GRVBase::
@@ -138,6 +157,8 @@ setup(double l, Energy2 scale, Energy2 mu2, Energy2 lam2) const {
     if ( l < 0.0 ) throw PDFRange(name(), "momentum fraction", thex, 1.0);
     theEps = Math::exp1m(-l);
     theRootx = sqrt(x());
+    theLogEps = log(eps());
+    theLogLx = log(lx());
   }
   if ( scale != Q2 || mu2 != theMu2 || lam2 != theLam2 ) {
     Q2 = scale;
@@ -158,6 +179,7 @@ setup(double l, Energy2 scale, Energy2 mu2, Energy2 lam2) const {
     theS2 = sqr(S());
     theS3 = S()*S2();
     theRootS = sqrt(S());
+    theLogS = log(S());
   }
 }
 
@@ -69,6 +69,16 @@ public:
    */
   virtual double xfvl(tcPDPtr particle, tcPDPtr parton, Energy2 partonScale,
 		     double l, Energy2 particleScale) const;
+
+  /**
+   * The densities for a batch of points. Fill the array \a xf with
+   * the densities of the \a partons inside the \a particle for the
+   * \a n given scales \a partonScales and momentum fractions \a x,
+   * evaluating each of the flavour functions only once per point.
+   */
+  virtual void xfxBatch(tcPDPtr particle, const cPDVector & partons, int n,
+			const Energy2 * partonScales, const double * x,
+			double * xf) const;
   //@}
 
 public:
@@ -156,6 +166,34 @@ protected:
   double heavysea(double sth, double al, double be, double ak, double ag,
 		  double b, double d, double e, double es) const;
 
+  /**
+   * Return the density of the parton with the given \a id inside a
+   * proton, or a neutron if \a neutron is true, or the corresponding
+   * anti-particle if \a anti is true, for the values previously given
+   * by setup().
+   */
+  double density(long id, bool anti, bool neutron) const;
+
+  /**
+   * Return \f$x^p\f$ using the logarithm saved by setup().
+   */
+  double xpow(double p) const { return p == 0.0? 1.0: exp(-p*lx()); }
+
+  /**
+   * Return eps\f$^p\f$ using the logarithm saved by setup().
+   */
+  double epspow(double p) const { return p == 0.0? 1.0: exp(p*theLogEps); }
+
+  /**
+   * Return \f$l^p\f$ using the logarithm saved by setup().
+   */
+  double lxpow(double p) const { return p == 0.0? 1.0: exp(p*theLogLx); }
+
+  /**
+   * Return \f$S^p\f$ using the logarithm saved by setup().
+   */
+  double Spow(double p) const { return p == 0.0? 1.0: exp(p*theLogS); }
+
   /**
    * Return the value of the u valens density for the values previously given
    * by setup().
@@ -282,6 +320,16 @@ private:
    */
   mutable double theRootx;
 
+  /**
+   * The logarithm of eps\f$=1-x\f$.
+   */
+  mutable double theLogEps;
+
+  /**
+   * The logarithm of \f$l=\log(1/x)\f$.
+   */
+  mutable double theLogLx;
+
   /**
    * The last selected scale.
    */
@@ -318,6 +366,11 @@ private:
    */
   mutable double theRootS;
 
+  /**
+   * Return last selected \f$\log(S)\f$.
+   */
+  mutable double theLogS;
+
   /**
    * Saved values from the different functions.
    */
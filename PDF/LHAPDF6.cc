@@ -44,6 +44,11 @@ ThePEG::LHAPDF::LHAPDF(const LHAPDF & x)
     theMaxFlav(x.theMaxFlav),
     xMin(x.xMin), xMax(x.xMax), Q2Min(x.Q2Min), Q2Max(x.Q2Max) {}
 
+ThePEG::LHAPDF::~LHAPDF() {
+  delete thePDF;
+  clearMemberPDFs();
+}
+
 ThePEG::IBPtr ThePEG::LHAPDF::clone() const {
   return new_ptr(*this);
 }
@@ -76,6 +81,13 @@ void ThePEG::LHAPDF::dofinish() {
   PDFBase::dofinish();
   delete thePDF;
   thePDF = 0;
+  clearMemberPDFs();
+}
+
+void ThePEG::LHAPDF::clearMemberPDFs() const {
+  for ( int i = 0, N = theMemberPDFs.size(); i < N; ++i )
+    delete theMemberPDFs[i];
+  theMemberPDFs.clear();
 }
 
 void ThePEG::LHAPDF::doinitrun() {
@@ -95,6 +107,7 @@ void ThePEG::LHAPDF::setPDFName(string name) {
   if ( name == "cteq6ll" ) name = "cteq6l1";
 
   if ( ::LHAPDF::contains(::LHAPDF::availablePDFSets(), name) ) {
+    if ( name != thePDFName ) clearMemberPDFs();
     thePDFName = name;
     theMember = 0;
   }
@@ -158,8 +171,6 @@ double ThePEG::LHAPDF::xfx(tcPDPtr particle, tcPDPtr parton,
 			   Energy2 partonScale,
 			   double x, double, Energy2) const {
   // Here we should return the actual density.
-  using namespace ThePEG::ParticleID;
-
   double Q2 = partonScale/GeV2;
 
    if ( ! thePDF->inRangeXQ2(x, Q2) ) {
@@ -177,9 +188,50 @@ double ThePEG::LHAPDF::xfx(tcPDPtr particle, tcPDPtr parton,
        }
    } 
 
-   int pid = parton->id();
-   int abspid = abs(pid);
-   
+  int f = flavour(particle, parton);
+  return f == 0? 0.0: thePDF->xfxQ2(f,x,Q2);
+}
+
+void ThePEG::LHAPDF::xfxMembers(tcPDPtr particle, tcPDPtr parton,
+				Energy2 partonScale,
+				double x, double * xf) const {
+  if ( theMemberPDFs.empty() ) theMemberPDFs = ::LHAPDF::mkPDFs(thePDFName);
+  const int N = theMemberPDFs.size();
+
+  double Q2 = partonScale/GeV2;
+
+  if ( ! thePDF->inRangeXQ2(x, Q2) ) {
+    switch ( rangeException ) {
+    case rangeThrow: Throw<Exception>()
+	<< "Momentum fraction (x=" << x << ") or scale (Q2=" << Q2
+	<< " GeV^2) was outside of limits in PDF " << name() << "."
+	<< Exception::eventerror;
+      break;
+    case rangeZero:
+      for ( int i = 0; i < N; ++i ) xf[i] = 0.0;
+      return;
+    case rangeFreeze:
+      x = min(max(x, xMin), xMax);
+      Q2 = min(max(Q2, Q2Min/GeV2), Q2Max/GeV2);
+    }
+  }
+
+  // The flavour mapping is done once for all members.
+  int f = flavour(particle, parton);
+  for ( int i = 0; i < N; ++i )
+    xf[i] = f == 0? 0.0: theMemberPDFs[i]->xfxQ2(f,x,Q2);
+}
+
+int ThePEG::LHAPDF::nMembers() const {
+  return ::LHAPDF::getPDFSet(thePDFName).size();
+}
+
+int ThePEG::LHAPDF::flavour(tcPDPtr particle, tcPDPtr parton) const {
+  using namespace ThePEG::ParticleID;
+
+  int pid = parton->id();
+  int abspid = abs(pid);
+
   switch ( pid ) {
   case t:
   case tbar:
@@ -187,48 +239,48 @@ double ThePEG::LHAPDF::xfx(tcPDPtr particle, tcPDPtr parton,
   case bbar:
   case c:
   case cbar:
-    return maxFlav() < abspid ? 0.0 : thePDF->xfxQ2(pid,x,Q2);
+    return maxFlav() < abspid ? 0 : pid;
   case s:
   case sbar:
-    return thePDF->xfxQ2(pid,x,Q2);
+    return pid;
   case u:
     switch ( particle->id() ) {
-    case n0:        return thePDF->xfxQ2(d   ,x,Q2);
-    case pbarminus: return thePDF->xfxQ2(ubar,x,Q2);
-    case nbar0:     return thePDF->xfxQ2(dbar,x,Q2);
+    case n0:        return d;
+    case pbarminus: return ubar;
+    case nbar0:     return dbar;
     case pplus:
-    default:        return thePDF->xfxQ2(u   ,x,Q2);
+    default:        return u;
     }
   case ubar:
     switch ( particle->id() ) {
-    case n0:        return thePDF->xfxQ2(dbar,x,Q2);
-    case pbarminus: return thePDF->xfxQ2(u   ,x,Q2);
-    case nbar0:     return thePDF->xfxQ2(d   ,x,Q2);
+    case n0:        return dbar;
+    case pbarminus: return u;
+    case nbar0:     return d;
     case pplus:
-    default:        return thePDF->xfxQ2(ubar,x,Q2);
+    default:        return ubar;
     }
   case d:
     switch ( particle->id() ) {
-    case n0:        return thePDF->xfxQ2(u   ,x,Q2);
-    case pbarminus: return thePDF->xfxQ2(dbar,x,Q2);
-    case nbar0:     return thePDF->xfxQ2(ubar,x,Q2);
+    case n0:        return u;
+    case pbarminus: return dbar;
+    case nbar0:     return ubar;
     case pplus:
-    default:        return thePDF->xfxQ2(d   ,x,Q2);
+    default:        return d;
     }
   case dbar:
     switch ( particle->id() ) {
-    case n0:        return thePDF->xfxQ2(ubar,x,Q2);
-    case pbarminus: return thePDF->xfxQ2(d   ,x,Q2);
-    case nbar0:     return thePDF->xfxQ2(u   ,x,Q2);
+    case n0:        return ubar;
+    case pbarminus: return d;
+    case nbar0:     return u;
     case pplus:
-    default:        return thePDF->xfxQ2(dbar,x,Q2);
+    default:        return dbar;
     }
   case g:
-    return thePDF->xfxQ2(g,x,Q2);
+    return g;
   case ParticleID::gamma:
-    return thePDF->xfxQ2(ParticleID::gamma,x,Q2);
+    return ParticleID::gamma;
   }
-  return 0.0;
+  return 0;
 }
 
 double ThePEG::LHAPDF::xfvl(tcPDPtr particle, tcPDPtr parton,
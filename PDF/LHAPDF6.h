@@ -49,6 +49,11 @@ public:
    * The copy constructor.
    */
   LHAPDF(const LHAPDF &);
+
+  /**
+   * The destructor.
+   */
+  virtual ~LHAPDF();
   //@}
 
 public:
@@ -112,6 +117,20 @@ public:
   virtual double xfsx(tcPDPtr particle, tcPDPtr parton, Energy2 partonScale,
 		      double x, double eps = 0.0,
 		      Energy2 particleScale = ZERO) const;
+
+  /**
+   * The number of members in the selected PDF set.
+   */
+  virtual int nMembers() const;
+
+  /**
+   * The densities of all members in the selected PDF set. The
+   * members are created the first time this function is called and
+   * the mapping of the \a parton to an LHAPDF flavour is only done
+   * once for all members.
+   */
+  virtual void xfxMembers(tcPDPtr particle, tcPDPtr parton,
+			  Energy2 partonScale, double x, double * xf) const;
   //@}
 
 
@@ -146,6 +165,12 @@ protected:
    */
   void initPDFptr();
 
+  /**
+   * Delete the members of the PDF set loaded by xfxMembers(), so
+   * that they are loaded again when next needed.
+   */
+  void clearMemberPDFs() const;
+
   /**
    * Used by the interface to select a set according to a file name.
    */
@@ -160,6 +185,12 @@ protected:
    * Interface for simple tests.
    */
   string doTest(string input);
+
+  /**
+   * Return the LHAPDF flavour code to be used for the given \a parton
+   * inside the given \a particle, or zero if the density vanishes.
+   */
+  int flavour(tcPDPtr particle, tcPDPtr parton) const;
   //@}
 
 public:
@@ -247,6 +278,11 @@ private:
    */
   ::LHAPDF::PDF * thePDF;
 
+  /**
+   * All members of the selected PDF set, used by xfxMembers().
+   */
+  mutable vector< ::LHAPDF::PDF * > theMemberPDFs;
+
   /**
    * The name of the selected PDF set.
    */
@@ -88,6 +88,19 @@ xfsl(tcPDPtr particle, tcPDPtr parton, Energy2 partonScale, double l,
 	     xfvl(particle,parton,partonScale,l,particleScale));
 }
 
+void PDFBase::xfxMembers(tcPDPtr particle, tcPDPtr parton,
+			 Energy2 partonScale, double x, double * xf) const {
+  xf[0] = xfx(particle, parton, partonScale, x);
+}
+
+void PDFBase::xfxBatch(tcPDPtr particle, const cPDVector & partons, int n,
+		       const Energy2 * partonScales, const double * x,
+		       double * xf) const {
+  for ( int i = 0; i < n; ++i )
+    for ( int j = 0, M = partons.size(); j < M; ++j )
+      *xf++ = xfx(particle, partons[j], partonScales[i], x[i]);
+}
+
 double PDFBase::flattenL(tcPDPtr, tcPDPtr, const PDFCuts & c,
 			 double z, double & jacobian) const {
   jacobian *= c.lMax() - c.lMin();
@@ -159,6 +159,36 @@ public:
 		      double x, double eps = 0.0,
 		      Energy2 particleScale = ZERO) const;
 
+  /**
+   * The number of members in the set of densities this object
+   * represents, such as the error members of an LHAPDF set. The
+   * default version returns 1.
+   */
+  virtual int nMembers() const { return 1; }
+
+  /**
+   * The densities of all members. Fill the array \a xf, which must
+   * have at least nMembers() elements, with the pdf for the given \a
+   * parton inside the given \a particle for the virtuality \a
+   * partonScale and momentum fraction \a x for each member. The
+   * default version simply calls xfx().
+   */
+  virtual void xfxMembers(tcPDPtr particle, tcPDPtr parton,
+			  Energy2 partonScale, double x, double * xf) const;
+
+  /**
+   * The densities for a batch of points. Fill the array \a xf, which
+   * must have at least \a n times the size of \a partons elements,
+   * with the pdf for each of the given \a partons inside the given \a
+   * particle for each of the \a n virtualities in \a partonScales and
+   * momentum fractions in \a x. The densities of point \a i are
+   * stored consecutively starting at <code>xf[i*partons.size()]</code>.
+   * The default version simply calls xfx() for each parton and point.
+   */
+  virtual void xfxBatch(tcPDPtr particle, const cPDVector & partons, int n,
+			const Energy2 * partonScales, const double * x,
+			double * xf) const;
+
   /**
    * Generate a momentum fraction. If the PDF contains strange peaks
    * which can be difficult to handle, this function may be
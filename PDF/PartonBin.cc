@@ -24,13 +24,17 @@
 
 using namespace ThePEG;
 
-PartonBin::PartonBin() : thePDFDim(), theRemDim() {}
+PartonBin::PartonBin()
+  : thePDFDim(), theRemDim(), hasLastPDF(false), theLastL(0.0),
+    theLastScale(ZERO), theLastIncomingScale(ZERO), theLastXF(0.0) {}
 
 PartonBin::
 PartonBin(tcPDPtr p, tPBPtr inc, tcPDPtr pi,
 	  tcPDFPtr pdf, const PDFCuts & newCuts)
   : theParticle(p), theIncomingBin(inc), theParton(pi), thePDF(pdf),
-    thePDFDim(0), theRemDim(0), theCuts(newCuts) {
+    thePDFDim(0), theRemDim(0), theCuts(newCuts), hasLastPDF(false),
+    theLastL(0.0), theLastScale(ZERO), theLastIncomingScale(ZERO),
+    theLastXF(0.0) {
   if ( pdf ) theRemnantHandler = pdf->remnantHandler();
 }
 
@@ -149,6 +149,39 @@ public:
   tPBPtr getFirst();
   //@}
 
+  /** @name The last parton density evaluated for this bin. */
+  //@{
+  /**
+   * If the parton density for this bin was last evaluated (and
+   * remembered with rememberPDF()) for the given logarithmic momentum
+   * fraction \a l, \a scale and scale \a incomingScale of the
+   * incoming particle, set \a xf to the value and return true. Used
+   * by PartonExtractor::fullFn() to share the evaluation between
+   * XCombs using the same bin.
+   */
+  bool lastPDF(double l, Energy2 scale, Energy2 incomingScale,
+	       double & xf) const {
+    if ( !hasLastPDF || l != theLastL || scale != theLastScale ||
+	 incomingScale != theLastIncomingScale ) return false;
+    xf = theLastXF;
+    return true;
+  }
+
+  /**
+   * Remember the value \a xf of the parton density for this bin
+   * evaluated for the given arguments.
+   * @see lastPDF()
+   */
+  void rememberPDF(double l, Energy2 scale, Energy2 incomingScale,
+		   double xf) const {
+    hasLastPDF = true;
+    theLastL = l;
+    theLastScale = scale;
+    theLastIncomingScale = incomingScale;
+    theLastXF = xf;
+  }
+  //@}
+
 public:
 
   /** @name Functions used by the persistent I/O system. */
@@ -224,6 +257,33 @@ private:
    */
   PDFCuts theCuts;
 
+  /**
+   * True if a parton density value has been remembered.
+   */
+  mutable bool hasLastPDF;
+
+  /**
+   * The logarithmic momentum fraction of the remembered parton
+   * density value.
+   */
+  mutable double theLastL;
+
+  /**
+   * The scale of the remembered parton density value.
+   */
+  mutable Energy2 theLastScale;
+
+  /**
+   * The scale of the incoming particle for the remembered parton
+   * density value.
+   */
+  mutable Energy2 theLastIncomingScale;
+
+  /**
+   * The remembered parton density value.
+   */
+  mutable double theLastXF;
+
 private:
 
   /**
@@ -28,7 +28,8 @@ PartonBinInstance::PartonBinInstance(const PartonBinInstance & x)
     theParton(x.theParton), thePartons(x.thePartons), theXi(x.theXi),
     theEps(x.theEps), theLi(x.theLi), theX(x.theX), theL(x.theL),
     theScale(x.theScale), theKT(x.theKT), theRemnantWeight(x.theRemnantWeight),
-    theRemnants(x.theRemnants), theRemInfo(x.theRemInfo) {}
+    theRemnants(x.theRemnants), theRecycledRemnants(x.theRecycledRemnants),
+    theRemInfo(x.theRemInfo) {}
 
 PartonBinInstance::PartonBinInstance(tcPBPtr pb, tPBIPtr pbi)
   : theBin(pb), theJacobian(1.0), theXi(-1.0), theEps(-1.0), theLi(-1.0),
@@ -83,6 +84,7 @@ void PartonBinInstance::reset(double lx, Energy2 Q2) {
   particle(tPPtr());
   parton(tPPtr());
   theRemnants.clear();
+  theRecycledRemnants.clear();
   thePartons.clear();
   remnantWeight(1.0);
 }
@@ -97,6 +99,19 @@ void PartonBinInstance::prepare() {
   incoming()->prepare();
 }
 
+void PartonBinInstance::recycle() {
+  li(-1.0);
+  l(0.0);
+  if ( !incoming() ) return;
+  l(-1.0);
+  scale(ZERO);
+  if ( !theRemnants.empty() ) theRemnants.swap(theRecycledRemnants);
+  theRemnants.clear();
+  thePartons.clear();
+  remnantWeight(1.0);
+  incoming()->recycle();
+}
+
 bool PartonBinInstance::hasPoleIn1() const {
   return ( !incoming() || incoming()->hasPoleIn1()) &&
     (!pdf() || pdf()->hasPoleIn1(particleData(), partonData()) );
@@ -151,6 +151,15 @@ public:
    */
   void prepare();
 
+  /**
+   * Reset last generated l and Q2 values of this and parent bins as
+   * in prepare(), but keep the particle and parton instances and move
+   * the remnants to recycledRemnants(), so that they may be reused
+   * for the next phase space point by the PartonExtractor and
+   * RemnantHandler.
+   */
+  void recycle();
+
   /**
    * Generate l and Q2 of this and parent bins.
    */
@@ -292,6 +301,12 @@ public:
    */
   void remnants(const PVector & rems) { theRemnants = rems; }
 
+  /**
+   * Get the remnants of the previous phase space point kept by
+   * recycle(), which may be reused by the RemnantHandler.
+   */
+  const PVector & recycledRemnants() const { return theRecycledRemnants; }
+
   /**
    * Get information saved by the remnant handler from the generation,
    * to be used in the construction of the remnants. (In addition the
@@ -421,6 +436,11 @@ private:
    */
   PVector theRemnants;
 
+  /**
+   * The remnants of the previous phase space point kept by recycle().
+   */
+  PVector theRecycledRemnants;
+
   /**
    * The information saved by the remnant handler from the generation,
    * to be used in the construction of the remnants. (In addition the
@@ -29,13 +29,15 @@
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Utilities/SimplePhaseSpace.h"
 #include "ThePEG/Utilities/UtilityBase.h"
+#include "ThePEG/Utilities/Profiler.h"
 #include "ThePEG/Repository/EventGenerator.h"
+#include "ThePEG/Handlers/EventHandler.h"
 #include "ThePEG/PDT/EnumParticles.h"
 
 using namespace ThePEG;
 
 PartonExtractor::PartonExtractor()
-  : theMaxTries(100), flatSHatY(false) {}
+  : theMaxTries(100), flatSHatY(false), theNPDFLookups(0), theNPDFHits(0) {}
 
 PartonExtractor::~PartonExtractor() {}
 
@@ -237,7 +239,13 @@ void PartonExtractor::
 generateL(PartonBinInstance & pb, const double * r) {
   if ( !pb.incoming() ) return;
 
-  pb.parton(pb.partonData()->produceParticle(Lorentz5Momentum()));
+  // A parton instance left by PartonBinInstance::recycle() is reused.
+  if ( pb.parton() && pb.parton()->dataPtr() == pb.partonData() )
+    pb.parton()->set5Momentum(Lorentz5Momentum());
+  else {
+    if ( pb.parton() ) partonBinInstances().erase(pb.parton());
+    pb.parton(pb.partonData()->produceParticle(Lorentz5Momentum()));
+  }
   generateL(*pb.incoming(), r + pb.bin()->pdfDim() + pb.bin()->remDim());
   pb.particle(pb.incoming()->parton());
 
@@ -461,9 +469,21 @@ double PartonExtractor::fullFn(const PartonBinInstance & pb,
     return 
       fullFn(*pb.incoming(),false) * pb.jacobian() * 
       pb.remnantWeight() * exp(-pb.li());
+  // XCombs sharing the same parton bin often ask for the same value.
+  double xf = 0.0;
+  ++theNPDFLookups;
+  if ( pb.bin()->lastPDF(pb.li(), pb.scale(), pb.incoming()->scale(), xf) )
+    ++theNPDFHits;
+  else {
+    {
+      Profiler::Timer timer(Profiler::pdf, pb.pdf());
+      xf = pb.pdf()->xfl(pb.particleData(), pb.partonData(), pb.scale(),
+			 pb.li(), pb.incoming()->scale());
+    }
+    pb.bin()->rememberPDF(pb.li(), pb.scale(), pb.incoming()->scale(), xf);
+  }
   return fullFn(*pb.incoming(),false) * pb.jacobian() * pb.remnantWeight() *
-    pb.pdf()->xfl(pb.particleData(), pb.partonData(), pb.scale(),
-		  pb.li(), pb.incoming()->scale());
+    xf;
 }
 
 void PartonExtractor::
@@ -647,8 +667,20 @@ RemColException::RemColException(const PartonExtractor & pe) {
   severity(maybeabort);
 }
   
+void PartonExtractor::doinitrun() {
+  HandlerBase::doinitrun();
+  theNPDFLookups = 0;
+  theNPDFHits = 0;
+}
+
 void PartonExtractor::dofinish() {
   // Only clear partonBinInstances if we have a lastXCombPtr 
   if(lastXCombPtr()) partonBinInstances().clear();
+  if ( theNPDFLookups > 0 && generator()->eventHandler() &&
+       generator()->eventHandler()->statLevel() > 1 )
+    generator()->log()
+      << "Parton densities requested by the parton extractor '" << name()
+      << "': " << theNPDFLookups << ", of which " << theNPDFHits << " ("
+      << 100.0*theNPDFHits/theNPDFLookups << "%) were reused." << endl;
   HandlerBase::dofinish();
 }
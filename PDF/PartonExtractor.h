@@ -207,6 +207,19 @@ public:
    */
   int maxTries() const { return theMaxTries; }
 
+  /**
+   * The number of parton density values requested in fullFn() in
+   * this run.
+   */
+  long nPDFLookups() const { return theNPDFLookups; }
+
+  /**
+   * The number of parton density values requested in fullFn() in
+   * this run which could be reused from the last evaluation for the
+   * same PartonBin.
+   */
+  long nPDFHits() const { return theNPDFHits; }
+
   /**
    * Return the PDFBase object to be used for the incoming particle
    * type. If one of theSpecialDensities matches the particle type it
@@ -369,6 +382,12 @@ protected:
   /** @name Standard Interfaced functions. */
   //@{
 
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+
   /**
    * Finalize this object. Called in the run phase just after a
    * run has ended. Used eg. to write out statistics.
@@ -419,6 +438,17 @@ private:
    */
   bool flatSHatY;
 
+  /**
+   * The number of parton density values requested in fullFn().
+   */
+  long theNPDFLookups;
+
+  /**
+   * The number of parton density values requested in fullFn() which
+   * were reused.
+   */
+  long theNPDFHits;
+
 private:
 
   /**
@@ -54,6 +54,15 @@ generate(PartonBinInstance & pb, const double *,
     p.rotateZ(parent.phi());
     pb.parton()->setMomentum(p);
   }
+  // Reuse the remnant kept by PartonBinInstance::recycle() if possible.
+  if ( pb.recycledRemnants().size() == 1 ) {
+    tRemPPtr rem = dynamic_ptr_cast<tRemPPtr>(pb.recycledRemnants()[0]);
+    if ( rem && rem->canRecycle(*pb.particle(), pb.parton()) ) {
+      if ( rem->recycle() ) pb.remnants(pb.recycledRemnants());
+      else pb.remnantWeight(0.0);
+      return pb.parton()->momentum();
+    }
+  }
   RemPPtr rem = new_ptr(RemnantParticle(*pb.particle(), remdec, pb.parton()));
   if ( rem->extracted().empty() ) pb.remnantWeight(0.0);
   pb.remnants(PVector(1, rem));
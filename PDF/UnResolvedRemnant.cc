@@ -85,6 +85,14 @@ generate(PartonBinInstance & pb, const double *r,
       pgam = pb.parton()->momentum();
     }
     Lorentz5Momentum prem=parent-pgam;
+    // Reuse the remnant kept by PartonBinInstance::recycle() if possible.
+    if ( pb.recycledRemnants().size() == 1 &&
+	 pb.recycledRemnants()[0]->dataPtr() == pb.particleData() ) {
+      pb.recycledRemnants()[0]->
+	set5Momentum(Lorentz5Momentum(prem, pb.particleData()->mass()));
+      pb.remnants(pb.recycledRemnants());
+      return pgam;
+    }
     PPtr rem = pb.particleData()->produceParticle(prem, pb.particleData()->mass());
     pb.remnants(PVector(1, rem));
     return pgam;
@@ -111,6 +119,13 @@ generate(PartonBinInstance & pb, const double *r,
     } else {
       prem = parent - pb.parton()->momentum();
     }
+    // Reuse the remnant kept by PartonBinInstance::recycle() if possible.
+    if ( pb.recycledRemnants().size() == 1 &&
+	 pb.recycledRemnants()[0]->dataPtr() == thePhoton ) {
+      pb.recycledRemnants()[0]->set5Momentum(Lorentz5Momentum(prem, ZERO));
+      pb.remnants(pb.recycledRemnants());
+      return parent - pb.remnants()[0]->momentum();
+    }
     PPtr rem = thePhoton->produceParticle(prem, ZERO);
     pb.remnants(PVector(1, rem));
     return parent - rem->momentum();
@@ -145,6 +160,14 @@ generate(PartonBinInstance & pb, const double *r, Energy2 scale, Energy2,
       pgam = pb.parton()->momentum();
     }
     Lorentz5Momentum prem=parent-pgam;
+    // Reuse the remnant kept by PartonBinInstance::recycle() if possible.
+    if ( pb.recycledRemnants().size() == 1 &&
+	 pb.recycledRemnants()[0]->dataPtr() == pb.particleData() ) {
+      pb.recycledRemnants()[0]->
+	set5Momentum(Lorentz5Momentum(prem, pb.particleData()->mass()));
+      pb.remnants(pb.recycledRemnants());
+      return pgam;
+    }
     PPtr rem = pb.particleData()->produceParticle(prem, pb.particleData()->mass());
     pb.remnants(PVector(1, rem));
     return pgam;
@@ -171,6 +194,13 @@ generate(PartonBinInstance & pb, const double *r, Energy2 scale, Energy2,
     } else {
       prem = parent - pb.parton()->momentum();
     }
+    // Reuse the remnant kept by PartonBinInstance::recycle() if possible.
+    if ( pb.recycledRemnants().size() == 1 &&
+	 pb.recycledRemnants()[0]->dataPtr() == thePhoton ) {
+      pb.recycledRemnants()[0]->set5Momentum(Lorentz5Momentum(prem, ZERO));
+      pb.remnants(pb.recycledRemnants());
+      return parent - pb.remnants()[0]->momentum();
+    }
     PPtr rem = thePhoton->produceParticle(prem, ZERO);
     pb.remnants(PVector(1, rem));
     return parent - rem->momentum();
@@ -13,12 +13,24 @@
 
 #include "BreitWignerMass.h"
 #include "ThePEG/PDT/ParticleData.h"
+#include "ThePEG/PDT/WidthGenerator.h"
 #include "ThePEG/Repository/EventGenerator.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Interface/Switch.h"
+#include "ThePEG/Interface/Parameter.h"
 #include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
 
 using namespace ThePEG;
 
+BreitWignerMass::BreitWignerMass()
+  : theTabulate(false), theRunningWidth(false), theTableSize(200) {}
+
+BreitWignerMass::BreitWignerMass(const BreitWignerMass & x)
+  : MassGenerator(x), theTabulate(x.theTabulate),
+    theRunningWidth(x.theRunningWidth), theTableSize(x.theTableSize) {}
+
 IBPtr BreitWignerMass::clone() const {
   return new_ptr(*this);
 }
@@ -28,6 +40,7 @@ IBPtr BreitWignerMass::fullclone() const {
 }
 
 Energy BreitWignerMass::mass(const ParticleData & pd) const {
+  if ( theTabulate || theRunningWidth ) return tabulatedMass(pd);
   Energy ret = ZERO;
   do {
     ret = UseRandom::rndRelBW(pd.mass(), pd.width(), pd.widthCut());
@@ -35,7 +48,98 @@ Energy BreitWignerMass::mass(const ParticleData & pd) const {
   return ret;
 }
 
-NoPIOClassDescription<BreitWignerMass> BreitWignerMass::initBreitWignerMass;
+Energy BreitWignerMass::tabulatedMass(const ParticleData & pd) const {
+  const MassTable & tab = table(pd);
+  if ( tab.t.empty() ) {
+    Energy ret = ZERO;
+    do {
+      ret = UseRandom::rndRelBW(pd.mass(), pd.width(), pd.widthCut());
+    } while ( ret > pd.massMax() || ret < pd.massMin() );
+    return ret;
+  }
+  const int N = tab.t.size();
+  double r = UseRandom::rnd()*(N - 1);
+  int i = min(int(r), N - 2);
+  double t = tab.t[i] + (r - i)*(tab.t[i + 1] - tab.t[i]);
+  return sqrt(max(sqr(tab.m0) + tab.m0*tab.w0*tan(t), ZERO));
+}
+
+const BreitWignerMass::MassTable &
+BreitWignerMass::table(const ParticleData & pd) const {
+  std::lock_guard<std::mutex> lock(theTableMutex);
+  auto it = theTables.find(&pd);
+  if ( it != theTables.end() ) return it->second;
+  // Elements of an unordered_map are never moved, so the reference
+  // stays valid after the lock is released.
+  MassTable & tab = theTables[&pd];
+  buildTable(pd, tab);
+  return tab;
+}
+
+void BreitWignerMass::buildTable(const ParticleData & pd,
+				 MassTable & tab) const {
+  tab.m0 = pd.mass();
+  tab.w0 = pd.width();
+  tab.t.clear();
+  if ( tab.w0 <= ZERO || pd.widthCut() <= ZERO || tab.m0 <= ZERO ) return;
+  const Energy2 mw = tab.m0*tab.w0;
+  const double tlo = atan((sqr(pd.massMin()) - sqr(tab.m0))/mw);
+  const double thi = atan((sqr(pd.massMax()) - sqr(tab.m0))/mw);
+  if ( thi <= tlo ) return;
+
+  // Tabulate the cumulative distribution in t, in which the
+  // Breit-Wigner with fixed width is flat.
+  const int N = max(theTableSize, 2);
+  const double dt = (thi - tlo)/(N - 1);
+  tcWidthGeneratorPtr wg;
+  if ( theRunningWidth ) wg = pd.widthGenerator();
+  vector<double> cdf(N, 0.0);
+  double fprev = 0.0;
+  for ( int i = 0; i < N; ++i ) {
+    double f = 1.0;
+    if ( wg ) {
+      double tt = tan(tlo + i*dt);
+      Energy m = sqrt(max(sqr(tab.m0) + mw*tt, ZERO));
+      double rw = wg->width(pd, m)/tab.w0;
+      f = rw > 0.0? rw*(1.0 + sqr(tt))/(sqr(tt) + sqr(rw)): 0.0;
+    }
+    if ( i > 0 ) cdf[i] = cdf[i - 1] + 0.5*(f + fprev);
+    fprev = f;
+  }
+  if ( cdf.back() <= 0.0 ) return;
+
+  // Invert the cumulative distribution for equidistant values.
+  tab.t.resize(N);
+  tab.t[0] = tlo;
+  tab.t[N - 1] = thi;
+  for ( int j = 1, k = 0; j < N - 1; ++j ) {
+    double u = cdf.back()*j/(N - 1);
+    while ( k < N - 2 && cdf[k + 1] <= u ) ++k;
+    double dc = cdf[k + 1] - cdf[k];
+    tab.t[j] = tlo + dt*(k + (dc > 0.0? (u - cdf[k])/dc: 0.0));
+  }
+}
+
+void BreitWignerMass::doinitrun() {
+  MassGenerator::doinitrun();
+  std::lock_guard<std::mutex> lock(theTableMutex);
+  theTables.clear();
+}
+
+void BreitWignerMass::persistentOutput(PersistentOStream & os) const {
+  os << theTabulate << theRunningWidth << theTableSize;
+}
+
+void BreitWignerMass::persistentInput(PersistentIStream & is, int version) {
+  if ( version >= 1 )
+    is >> theTabulate >> theRunningWidth >> theTableSize;
+  else {
+    theTabulate = theRunningWidth = false;
+    theTableSize = 200;
+  }
+}
+
+ClassDescription<BreitWignerMass> BreitWignerMass::initBreitWignerMass;
 
 void BreitWignerMass::Init() {
 
@@ -43,5 +147,46 @@ void BreitWignerMass::Init() {
     ("Generates masses of particle instances according to a Breit-Wigner "
      "distribution.");
 
+  static Switch<BreitWignerMass,bool> interfaceTabulate
+    ("Tabulate",
+     "Generate masses from a tabulated distribution which is built for "
+     "each particle type the first time a mass is requested.",
+     &BreitWignerMass::theTabulate, false, true, false);
+  static SwitchOption interfaceTabulateYes
+    (interfaceTabulate,
+     "Yes",
+     "Use tabulated distributions.",
+     true);
+  static SwitchOption interfaceTabulateNo
+    (interfaceTabulate,
+     "No",
+     "Generate masses directly.",
+     false);
+
+  static Switch<BreitWignerMass,bool> interfaceRunningWidth
+    ("RunningWidth",
+     "Use the mass-dependent width given by the width generator of the "
+     "particle type, if present. The width generator is only called when "
+     "the table is built and the tabulated distributions are always used "
+     "if this switch is on.",
+     &BreitWignerMass::theRunningWidth, false, true, false);
+  static SwitchOption interfaceRunningWidthYes
+    (interfaceRunningWidth,
+     "Yes",
+     "Use the width given by the width generator.",
+     true);
+  static SwitchOption interfaceRunningWidthNo
+    (interfaceRunningWidth,
+     "No",
+     "Use the nominal width of the particle type.",
+     false);
+
+  static Parameter<BreitWignerMass,int> interfaceTableSize
+    ("TableSize",
+     "The number of points in the tabulated distribution of each particle "
+     "type.",
+     &BreitWignerMass::theTableSize, 200, 10, 100000,
+     true, false, Interface::limited);
+
 }
 
@@ -11,6 +11,8 @@
 // This is the declaration of the BreitWignerMass class.
 
 #include "ThePEG/PDT/MassGenerator.h"
+#include <unordered_map>
+#include <mutex>
 
 namespace ThePEG {
 
@@ -19,13 +21,38 @@ namespace ThePEG {
  * generate the mass for a particle given its nominal mass and its
  * with.
  *
+ * Optionally the masses may be generated from a tabulated inverse of
+ * the cumulative distribution, which is built for each particle type
+ * the first time a mass is requested and is then shared by all
+ * subsequent calls. The tabulated distribution is restricted to the
+ * allowed mass range directly, so that no masses need to be
+ * rejected, and may include a running width given by the
+ * WidthGenerator of the particle type, in which case the width
+ * generator is only called when the table is built.
  *
+ * @see \ref BreitWignerMassInterfaces "The interfaces"
+ * defined for BreitWignerMass.
  * @see MassGenerator
  * @see ParticleData
  * 
  */
 class BreitWignerMass: public MassGenerator {
 
+public:
+
+  /** @name Standard constructors and destructors. */
+  //@{
+  /**
+   * The default constructor.
+   */
+  BreitWignerMass();
+
+  /**
+   * The copy constructor. The tables are not copied.
+   */
+  BreitWignerMass(const BreitWignerMass &);
+  //@}
+
 public:
 
   /** @name Virtual methods required by the MassGenerator base class. */
@@ -42,8 +69,64 @@ public:
   virtual Energy mass(const ParticleData &) const;
   //@}
 
+protected:
+
+  /**
+   * A tabulated mass distribution for a particle type. The masses
+   * are parameterized by \f$m^2=m_0^2+m_0\Gamma_0\tan t\f$, in which
+   * variable a Breit-Wigner with fixed width is flat, and the values
+   * of \f$t\f$ are given for equidistant values of the cumulative
+   * distribution.
+   */
+  struct MassTable {
+
+    /** The nominal mass. */
+    Energy m0;
+
+    /** The nominal width. */
+    Energy w0;
+
+    /** The values of t for equidistant values of the cumulative
+     *  distribution. Empty if the distribution vanishes. */
+    vector<double> t;
+
+  };
+
+  /**
+   * Generate a mass for an instance of a given particle type from the
+   * corresponding table.
+   */
+  Energy tabulatedMass(const ParticleData &) const;
+
+  /**
+   * Return the table for the given particle type, building it if it
+   * did not exist.
+   */
+  const MassTable & table(const ParticleData &) const;
+
+  /**
+   * Build the table for the given particle type.
+   */
+  void buildTable(const ParticleData &, MassTable &) const;
+
 public:
 
+  /** @name Functions used by the persistent I/O system. */
+  //@{
+  /**
+   * Function used to write out object persistently.
+   * @param os the persistent output stream written to.
+   */
+  void persistentOutput(PersistentOStream & os) const;
+
+  /**
+   * Function used to read in object persistently.
+   * @param is the persistent input stream read from.
+   * @param version the version number of the object when written.
+   */
+  void persistentInput(PersistentIStream & is, int version);
+  //@}
+
   /**
    * Standard Init function used to initialize the interface.
    */
@@ -66,12 +149,51 @@ protected:
   virtual IBPtr fullclone() const;
   //@}
 
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins.
+   */
+  virtual void doinitrun();
+  //@}
+
+private:
+
+  /**
+   * If true, masses are generated from tabulated distributions.
+   */
+  bool theTabulate;
+
+  /**
+   * If true, the width given by the WidthGenerator of a particle type
+   * is used in the tabulated distributions.
+   */
+  bool theRunningWidth;
+
+  /**
+   * The number of points in each table.
+   */
+  int theTableSize;
+
+  /**
+   * The tables built so far, indexed by particle type.
+   */
+  mutable std::unordered_map<const ParticleData *, MassTable> theTables;
+
+  /**
+   * Protect theTables when they are built.
+   */
+  mutable std::mutex theTableMutex;
+
 private:
 
   /**
-   * Describe concrete class without persistent data.
+   * Describe a concrete class with persistent data.
    */
-  static NoPIOClassDescription<BreitWignerMass> initBreitWignerMass;
+  static ClassDescription<BreitWignerMass> initBreitWignerMass;
 
   /**
    *  Private and non-existent assignment operator.
@@ -82,7 +204,33 @@ private:
 
 
 /** @cond TRAITSPECIALIZATIONS */
-ThePEG_DECLARE_DYNAMIC_CLASS_TRAITS(BreitWignerMass,MassGenerator,"BreitWignerMass.so");
+
+/** This template specialization informs ThePEG about the base classes
+ *  of BreitWignerMass. */
+template <>
+struct BaseClassTrait<BreitWignerMass,1>: public ClassTraitsType {
+  /** Typedef of the first base class of BreitWignerMass. */
+  typedef MassGenerator NthBase;
+};
+
+/** This template specialization informs ThePEG about the name of
+ *  the BreitWignerMass class and the shared object where it is
+ *  defined. */
+template <>
+struct ClassTraits<BreitWignerMass>
+  : public ClassTraitsBase<BreitWignerMass> {
+  /** Return a platform-independent class name */
+  static string className() { return "ThePEG::BreitWignerMass"; }
+  /** Return the name of the shared library be loaded to get access to
+   *  the BreitWignerMass class and every other class it uses
+   *  (except the base class). */
+  static string library() { return "BreitWignerMass.so"; }
+  /** Return the class version. Version 1 added the switches for
+   *  tabulated distributions, earlier versions had no persistent
+   *  data. */
+  static int version() { return 1; }
+};
+
 /** @endcond */
 
 }
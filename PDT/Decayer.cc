@@ -19,6 +19,7 @@
 #include "ThePEG/PDT/DecayMode.h"
 #include "ThePEG/Utilities/UtilityBase.h"
 #include "ThePEG/Utilities/Throw.h"
+#include "ThePEG/Utilities/Profiler.h"
 #include "ThePEG/EventRecord/Step.h"
 #include "ThePEG/EventRecord/Particle.h"
 #include "ThePEG/PDT/DecayMode.h"
@@ -97,31 +98,40 @@ ParticleVector Decayer::DecayParticle(tPPtr parent, Step & s, long maxtry) {
     if ( !dm ) Throw<DecayFailure>()
       << "Could not decay particle " << parent->data().PDGName() << " since "
       << " no decay mode was found." << Exception::runerror;
-    if ( !dm->decayer() ) Throw<DecayFailure>()
-      << "Could not perform the decay " << dm->tag()
-      << " since the decay mode was not associated with a decayer."
-      << Exception::runerror;
-    try {
-      if ( dm->decayer()->needsFullStep() )
-	children = dm->decayer()->decay(*dm, *parent, s);
-      else
-	children = dm->decayer()->decay(*dm, *parent);
-      if ( !children.empty() ) {
-	parent->decayMode(dm);
-	for ( int i = 0, N = children.size(); i < N; ++i )
-	  if ( !s.addDecayProduct(parent, children[i]) )Throw<DecayFailure>()
-	    << "An error occurred when tryin to decay an unstable particle "
-	    << "of type " << parent->data().PDGName() << ". One of the "
-	    << "produced children (of type " << children[i]->data().PDGName()
-	    << ") could not be added to the current step."
-	    << Exception::abortnow;
-	parent->scale(ZERO);
-	return children;
-      }
-    }
-    catch (DecayFailure & e) {
-      throw e;
+    children = DecayParticle(parent, s, dm);
+    if ( !children.empty() ) return children;
+  }
+}
+
+ParticleVector Decayer::DecayParticle(tPPtr parent, Step & s, tDMPtr dm) {
+  ParticleVector children;
+  if ( !dm->decayer() ) Throw<DecayFailure>()
+    << "Could not perform the decay " << dm->tag()
+    << " since the decay mode was not associated with a decayer."
+    << Exception::runerror;
+  try {
+    Profiler::Timer timer(Profiler::decayer, dm->decayer());
+    if ( dm->decayer()->needsFullStep() )
+      children = dm->decayer()->decay(*dm, *parent, s);
+    else
+      children = dm->decayer()->decay(*dm, *parent);
+    if ( !children.empty() ) {
+      parent->decayMode(dm);
+      for ( int i = 0, N = children.size(); i < N; ++i )
+	if ( !s.addDecayProduct(parent, children[i]) )Throw<DecayFailure>()
+	  << "An error occurred when tryin to decay an unstable particle "
+	  << "of type " << parent->data().PDGName() << ". One of the "
+	  << "produced children (of type " << children[i]->data().PDGName()
+	  << ") could not be added to the current step."
+	  << Exception::abortnow;
+      parent->scale(ZERO);
     }
-    catch (Veto) {}
   }
+  catch (DecayFailure & e) {
+    throw e;
+  }
+  catch (Veto) {
+    children.clear();
+  }
+  return children;
 }
@@ -136,6 +136,17 @@ public:
   static ParticleVector
   DecayParticle(tPPtr parent, Step & step, long maxtry = 1000);
 
+  /**
+   * Static function to perform one attempt to decay a \a parent
+   * particle using the given decay mode \a dm. If successful, the
+   * children are properly added to the particle and to the given \a
+   * step. The \a parent must be final and not already decayed.
+   * @return the produced children or an empty vector if the decay
+   * failed and should be retried.
+   */
+  static ParticleVector
+  DecayParticle(tPPtr parent, Step & step, tDMPtr dm);
+
   /**
    * Exception class used if something goes wrong in DecayParticle().
    */
@@ -41,17 +41,15 @@ bool FlatDecayer::accept(const DecayMode & dm) const {
 ParticleVector FlatDecayer::decay(const DecayMode & dm,
 				  const Particle & parent) const {
   ParticleVector children = getChildren(dm, parent);
+  if ( children.size() == 1 ) {
+    children[0]->setMomentum(parent.momentum());
+    children[0]->scale(parent.momentum().mass2());
+    return children;
+  }
   try {
-    do {
-      if ( children.size() == 1 ) {
-	children[0]->setMomentum(parent.momentum());
-	children[0]->scale(parent.momentum().mass2());
-	return children;
-      }
-      else {
-	SimplePhaseSpace::CMSn(children, parent.mass());
-      }
-    } while ( reweight(dm, parent, children) < UseRandom::rnd() );
+    SimplePhaseSpace::CMSn(children, parent.mass(), [&]() {
+	return reweight(dm, parent, children);
+      });
   }
   catch ( ImpossibleKinematics & ) {
     children.clear();
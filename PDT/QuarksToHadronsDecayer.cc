@@ -147,15 +147,14 @@ getHadrons(int Nh, tcPDVector quarks) const {
 
 void QuarksToHadronsDecayer::
 distribute(const Particle & parent, PVector & children) const {
-  do {
-    try {
-      SimplePhaseSpace::CMSn(children, parent.mass());
-    }
-    catch ( ImpossibleKinematics & e) {
-      children.clear();
-      return;
-    }
-  } while ( reweight(parent, children) < rnd() );
+  try {
+    SimplePhaseSpace::CMSn(children, parent.mass(), [&]() {
+	return reweight(parent, children);
+      });
+  }
+  catch ( ImpossibleKinematics & e) {
+    children.clear();
+  }
 }
 
 double QuarksToHadronsDecayer::
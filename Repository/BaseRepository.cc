@@ -68,6 +68,17 @@ ObjectSet & BaseRepository::allObjects() {
   return theObjectSet;
 }
 
+BaseRepository::ObjectCache & BaseRepository::objectCache() {
+  static ObjectCache theObjectCache;
+  return theObjectCache;
+}
+
+BaseRepository::InterfaceCache & BaseRepository::interfaceCache(bool all) {
+  static InterfaceCache theInterfaceCache;
+  static InterfaceCache theAllInterfaceCache;
+  return all? theAllInterfaceCache: theInterfaceCache;
+}
+
 BaseRepository::TypeInterfaceMap & BaseRepository::interfaces() {
   static TypeInterfaceMap theInterfaceMap;
   return theInterfaceMap;
@@ -128,7 +139,10 @@ BaseRepository::StringVector & BaseRepository::directoryStack() {
 
 void BaseRepository::Register(const InterfaceBase & ib, const type_info & i) {
   const ClassDescriptionBase * db = DescriptionList::find(i);
-  if ( db ) interfaces()[db].insert(&ib);
+  if ( !db ) return;
+  interfaces()[db].insert(&ib);
+  interfaceCache(true).clear();
+  interfaceCache(false).clear();
 }
 
 void BaseRepository::
@@ -207,8 +221,12 @@ void BaseRepository::PopDirectory() {
 }
 
 IBPtr BaseRepository::GetPointer(string name) {
+  ObjectCache::const_iterator cit = objectCache().find(name);
+  if ( cit != objectCache().end() ) return cit->second;
   ObjectMap::iterator it = objects().find(name);
-  return it == objects().end()? IBPtr(): it->second;
+  if ( it == objects().end() ) return IBPtr();
+  objectCache()[name] = it->second;
+  return it->second;
 }
 
 IVector BaseRepository::SearchDirectory(string name, string className) {
@@ -245,8 +263,8 @@ IVector BaseRepository::GetObjectsReferringTo(IBPtr obj) {
 IVector BaseRepository::DirectReferences(IBPtr obj) {
   IVector ov = obj->getReferences();
   const auto & tmp=*obj;
-  InterfaceMap interfaceMap = getInterfaces(typeid(tmp));
-  for ( InterfaceMap::iterator iit = interfaceMap.begin();
+  const InterfaceMap & interfaceMap = cachedInterfaces(typeid(tmp));
+  for ( InterfaceMap::const_iterator iit = interfaceMap.begin();
 	iit != interfaceMap.end(); ++iit ) {
     IVector ovi = iit->second->getReferences(*obj);
     ov.insert(ov.end(), ovi.begin(), ovi.end());
@@ -262,8 +280,8 @@ addReferences(tIBPtr obj, ObjectSet & refs) {
   for ( IVector::const_iterator it = ov.begin(); it != ov.end(); ++it )
     if ( !member(refs, *it) ) addReferences(*it, refs);
   const auto & tmp=*obj;
-  InterfaceMap interfaceMap = getInterfaces(typeid(tmp));
-  for ( InterfaceMap::iterator iit = interfaceMap.begin();
+  const InterfaceMap & interfaceMap = cachedInterfaces(typeid(tmp));
+  for ( InterfaceMap::const_iterator iit = interfaceMap.begin();
 	iit != interfaceMap.end(); ++iit ) {
     IVector ov = iit->second->getReferences(*obj);
     for ( IVector::const_iterator it = ov.begin(); it != ov.end(); ++it )
@@ -295,11 +313,24 @@ InterfaceMap BaseRepository::getInterfaces(const type_info & ti, bool all) {
   return interfaceMap;
 }
 
+const InterfaceMap &
+BaseRepository::cachedInterfaces(const type_info & ti, bool all) {
+  static const InterfaceMap empty;
+  const ClassDescriptionBase * db = DescriptionList::find(ti);
+  if ( !db ) return empty;
+  InterfaceCache & cache = interfaceCache(all);
+  InterfaceCache::iterator it = cache.find(db);
+  if ( it != cache.end() ) return it->second;
+  InterfaceMap & interfaceMap = cache[db];
+  addInterfaces(*db, interfaceMap, all);
+  return interfaceMap;
+}
+
 void BaseRepository::
 rebind(InterfacedBase & i, const TranslationMap & trans,
        const IVector & defaults) {
-  InterfaceMap interfaceMap = getInterfaces(typeid(i), true);
-  for ( InterfaceMap::iterator iit = interfaceMap.begin();
+  const InterfaceMap & interfaceMap = cachedInterfaces(typeid(i), true);
+  for ( InterfaceMap::const_iterator iit = interfaceMap.begin();
 	iit != interfaceMap.end(); ++iit )
     iit->second->rebind(i, trans, defaults);
   i.rebind(trans);
@@ -334,6 +365,7 @@ void BaseRepository::remove(tIBPtr ip) {
   if ( it == objects().end() || ip != it->second ) return;
   objects().erase(it);
   allObjects().erase(ip);
+  objectCache().clear();
 }
 
 string BaseRepository::remove(const ObjectSet & rmset) {
@@ -368,6 +400,7 @@ void BaseRepository::rename(tIBPtr ip, string newName) {
     throw RepoNameException(ip->fullName());
   
   objects().erase(mit);
+  objectCache().clear();
   ip->name(newName);
   while ( member(objects(), ip->fullName()) ) ip->name(ip->fullName() + "#");
   objects()[ip->fullName()] = ip;
@@ -375,8 +408,8 @@ void BaseRepository::rename(tIBPtr ip, string newName) {
 
 const InterfaceBase * BaseRepository::FindInterface(IBPtr ip, string name) {
   const auto & tmp=*ip;
-  InterfaceMap imap = getInterfaces(typeid(tmp), false);
-  InterfaceMap::iterator it = imap.find(name);
+  const InterfaceMap & imap = cachedInterfaces(typeid(tmp), false);
+  InterfaceMap::const_iterator it = imap.find(name);
   return it == imap.end()? 0: it->second;
 }
 
@@ -16,6 +16,7 @@
 #include "ThePEG/Interface/ClassDocumentation.fh"
 #include "ThePEG/Interface/InterfacedBase.h"
 #include "ThePEG/Utilities/ClassDescription.fh"
+#include <unordered_map>
 
 namespace ThePEG {
 
@@ -63,6 +64,14 @@ public:
       ClassDescriptionBase objects. */
   typedef map<const ClassDescriptionBase *, const ClassDocumentationBase *>
     TypeDocumentationMap;
+
+  /** A hashed map of objects indexed by their full name. */
+  typedef std::unordered_map<string, IBPtr> ObjectCache;
+
+  /** A hashed map of InterfaceMap objects indexed by pointers to
+      ClassDescriptionBase objects. */
+  typedef std::unordered_map<const ClassDescriptionBase *, InterfaceMap>
+    InterfaceCache;
  
 public:
 
@@ -516,6 +525,15 @@ protected:
   static void addInterfaces(const ClassDescriptionBase &,
 			    InterfaceMap &, bool all = true);
 
+  /**
+   * Return the interfaces of the class with the given type_info, as
+   * given by getInterfaces(), but without rebuilding the map from the
+   * class hierarchy each time. The result is cached in
+   * interfaceCache().
+   */
+  static const InterfaceMap & cachedInterfaces(const type_info & ti,
+					       bool all = true);
+
   /** @name Functions containing the static instances of objects used
       by the repository. */
   //@{
@@ -529,6 +547,21 @@ protected:
    */
   static ObjectSet & allObjects();
 
+  /**
+   * Objects which have been looked up with GetPointer() mapped to
+   * their full name. This is a hashed short-cut for objects() and must
+   * be cleared whenever an object is removed from, or replaced in,
+   * objects().
+   */
+  static ObjectCache & objectCache();
+
+  /**
+   * The interfaces of the classes which have been looked up by
+   * cachedInterfaces(). Separate caches are kept for the \a all
+   * flag. Both are cleared whenever a new interface is registered.
+   */
+  static InterfaceCache & interfaceCache(bool all);
+
   /**
    * Sets of InterfaceBase objects mapped to the class description of
    * the class for which they are defined.
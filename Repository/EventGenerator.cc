@@ -18,6 +18,7 @@
 #include "ThePEG/Utilities/HoldFlag.h"
 #include "ThePEG/Utilities/Debug.h"
 #include "ThePEG/Utilities/DebugItem.h"
+#include "ThePEG/Utilities/Profiler.h"
 #include "ThePEG/Interface/Interfaced.h"
 #include "ThePEG/Interface/Reference.h"
 #include "ThePEG/Interface/RefVector.h"
@@ -82,7 +83,8 @@ EventGenerator::EventGenerator()
     theDebugLevel(0), logNonDefault(-1), printEvent(0), dumpPeriod(0),
     keepAllDumps(false),
     debugEvent(0), maxWarnings(10), maxErrors(10), theCurrentRandom(0),
-    theCurrentGenerator(0), useStdout(false), theIntermediateOutput(false) {}
+    theCurrentGenerator(0), useStdout(false), theIntermediateOutput(false),
+    theProfiling(Profiler::off), theProfilingCalls(100000), theProfiler(0) {}
 
 EventGenerator::EventGenerator(const EventGenerator & eg)
   : Interfaced(eg), theDefaultObjects(eg.theDefaultObjects),
@@ -109,10 +111,13 @@ EventGenerator::EventGenerator(const EventGenerator & eg)
     theCurrentEventHandler(eg.theCurrentEventHandler),
     theCurrentStepHandler(eg.theCurrentStepHandler),
     useStdout(eg.useStdout),
-    theIntermediateOutput(eg.theIntermediateOutput) {}
+    theIntermediateOutput(eg.theIntermediateOutput),
+    theProfiling(eg.theProfiling), theProfilingCalls(eg.theProfilingCalls),
+    theProfiler(0) {}
 
 EventGenerator::~EventGenerator() {
   if ( theCurrentRandom ) delete theCurrentRandom;
+  if ( theProfiler ) delete theProfiler;
   if ( theCurrentGenerator ) delete theCurrentGenerator;
 }
 
@@ -314,6 +319,11 @@ void EventGenerator::doinitrun() {
 
   weightSum = 0.0;
 
+  if ( theProfiling ) {
+    if ( !theProfiler ) theProfiler = new Profiler;
+    theProfiler->start(theProfiling, theProfilingCalls);
+  }
+
 }
 
 PDPtr EventGenerator::getParticleData(PID id) const {
@@ -374,6 +384,18 @@ void EventGenerator::dofinish() {
 
   theExceptions.clear();
 
+  if ( theProfiler && theProfiler->level() ) {
+    theProfiler->writeSummary(log());
+    if ( theProfiler->level() >= Profiler::trace ) {
+      string file = filename() + "-trace.json";
+      if ( theProfiler->writeTrace(file) )
+	log() << "Profiling trace written to '" << file << "'.\n";
+      else
+	log() << "Could not write profiling trace to '" << file << "'.\n";
+    }
+    theProfiler->stop();
+  }
+
   const string & msg = theMiscStream.str();
   if ( ! msg.empty() ) {
     log() << endl 
@@ -453,8 +475,10 @@ EventPtr EventGenerator::doShoot() {
 	
 	// Analyze the possibly uncomplete event
 	for ( AnalysisVector::iterator it = analysisHandlers().begin();
-	      it != analysisHandlers().end(); ++it )
+	      it != analysisHandlers().end(); ++it ) {
+	  Profiler::Timer timer(Profiler::analysis, *it);
 	  (**it).analyze(event, ieve, loop, state);
+	}
 	
 	// Manipulate the current event, possibly deleting some steps
 	// and telling the event handler to redo them.
@@ -832,10 +856,10 @@ void EventGenerator::persistentOutput(PersistentOStream & os) const {
      << dumpPeriod << keepAllDumps << debugEvent
      << maxWarnings << maxErrors << theCurrentEventHandler
      << theCurrentStepHandler << useStdout << theIntermediateOutput << theMiscStream.str()
-     << Repository::listReadDirs();
+     << Repository::listReadDirs() << theProfiling << theProfilingCalls;
 }
 
-void EventGenerator::persistentInput(PersistentIStream & is, int) {
+void EventGenerator::persistentInput(PersistentIStream & is, int version) {
   string dummy;
   vector<string> readdirs;
   theGlobalLibraries = is.globalLibraries();
@@ -849,6 +873,11 @@ void EventGenerator::persistentInput(PersistentIStream & is, int) {
      >> maxWarnings >> maxErrors >> theCurrentEventHandler
      >> theCurrentStepHandler >> useStdout >> theIntermediateOutput >> dummy
      >> readdirs;
+  if ( version >= 1 ) is >> theProfiling >> theProfilingCalls;
+  else {
+    theProfiling = Profiler::off;
+    theProfilingCalls = 100000;
+  }
   theMiscStream.str(dummy);
   theMiscStream.seekp(0, std::ios::end);
   theObjects.clear();
@@ -1404,6 +1433,40 @@ void EventGenerator::Init() {
      "but no further information on the intermediate cross section estimate.",
      false);
 
+  static Switch<EventGenerator,int> interfaceProfiling
+    ("Profiling",
+     "Collect the time spent and the number of calls to "
+     "StepHandler::handle, MEBase::dSigHatDR, the PDFBase::xfl evaluations "
+     "in PartonExtractor::fullFn, Decayer::decay and "
+     "AnalysisHandler::analyze for each object during the run. A "
+     "summary is written to the log file at the end of the run.",
+     &EventGenerator::theProfiling, Profiler::off, true, false);
+  static SwitchOption interfaceProfilingOff
+    (interfaceProfiling,
+     "Off",
+     "No profiling is done.",
+     Profiler::off);
+  static SwitchOption interfaceProfilingReport
+    (interfaceProfiling,
+     "Report",
+     "Write a summary of the cumulative times and number of calls to the "
+     "log file.",
+     Profiler::report);
+  static SwitchOption interfaceProfilingTrace
+    (interfaceProfiling,
+     "Trace",
+     "As <interface>Report</interface>, but also write the individual calls "
+     "to a file <i>run-name</i>-trace.json in the Chrome trace event format, "
+     "to be viewed in e.g. chrome://tracing or Perfetto.",
+     Profiler::trace);
+
+  static Parameter<EventGenerator,long> interfaceProfilingCalls
+    ("ProfilingCalls",
+     "The maximum number of individual calls to write to the trace file if "
+     "<interface>Profiling</interface> is set to <code>Trace</code>.",
+     &EventGenerator::theProfilingCalls, 100000, 0, 0,
+     true, false, Interface::lowerlim);
+
 }
 
 EGNoPath::EGNoPath(string path) {
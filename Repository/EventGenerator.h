@@ -25,6 +25,8 @@
 
 namespace ThePEG {
 
+class Profiler;
+
 /**
  * The EventGenerator class manages a whole event generator run. It
  * keeps a list of all Interfaced objects which are needed for a
@@ -128,6 +130,12 @@ public:
    */
   tStepHdlPtr currentStepHandler() const { return theCurrentStepHandler; }
 
+  /**
+   * The Profiler used in this run, or null if the profiling is
+   * switched off.
+   */
+  Profiler * profiler() const { return theProfiler; }
+
   /**
    * Set the currently active step handler.
    */
@@ -1141,6 +1149,22 @@ private:
    */
   bool theIntermediateOutput;
 
+  /**
+   * The level of profiling (see Profiler::Level) to be done in the run.
+   */
+  int theProfiling;
+
+  /**
+   * The maximum number of individual calls to be written to the
+   * trace file if theProfiling is Profiler::trace.
+   */
+  long theProfilingCalls;
+
+  /**
+   * The Profiler used in this run if theProfiling is switched on.
+   */
+  Profiler * theProfiler;
+
   /**
    * The global libraries needed for objects used in this EventGenerator.
    */
@@ -1176,6 +1200,9 @@ template <>
 struct ClassTraits<EventGenerator>: public ClassTraitsBase<EventGenerator> {
   /** Return a platform-independent class name */
   static string className() { return "ThePEG::EventGenerator"; }
+  /** Return the class version. Version 1 added the profiling
+   *  switches. */
+  static int version() { return 1; }
 };
 
 /** @endcond */
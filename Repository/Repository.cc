@@ -27,6 +27,9 @@
 #include "ThePEG/Config/algorithm.h"
 #include "ThePEG/Utilities/DynamicLoader.h"
 #include "ThePEG/Utilities/StringUtils.h"
+#include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Interface/ParVector.h"
+#include "ThePEG/Interface/Switch.h"
 
 #include <iterator>
 #include <chrono>
@@ -78,6 +81,58 @@ MatcherSet & Repository::matchers() {
   return theSet;
 }
 
+Repository::ParticleNameMap & Repository::particleNames() {
+  static ParticleNameMap theMap;
+  return theMap;
+}
+
+Repository::MatcherNameMap & Repository::matcherNames() {
+  static MatcherNameMap theMap;
+  return theMap;
+}
+
+void Repository::clearNameIndices() {
+  particleNames().clear();
+  matcherNames().clear();
+}
+
+Repository::RunSnapshotMap & Repository::runSnapshots() {
+  static RunSnapshotMap theMap;
+  return theMap;
+}
+
+void Repository::clearRunSnapshots() {
+  runSnapshots().clear();
+}
+
+bool Repository::isStructural(string verb, string command) {
+  if ( verb == "get" || verb == "def" || verb == "min" || verb == "max" ||
+       verb == "describe" || verb == "fulldescribe" || verb == "ls" ||
+       verb == "lsclass" || verb == "lsruns" || verb == "pwd" ||
+       verb == "cd" || verb == "pushd" || verb == "popd" ||
+       verb == "help" || verb == "save" || verb == "makerun" ||
+       verb == "saverun" || verb == "saverunfile" || verb == "run" ||
+       verb == "rmrun" || verb == "removerun" || verb == "mkdir" ||
+       verb == "EXITONERROR" ) return false;
+  if ( verb != "set" && verb != "setdef" ) return true;
+  // Only look at plain 'object:interface' nouns, anything else may
+  // involve commands being executed while tracing the object.
+  string noun = StringUtils::car(command);
+  string::size_type colon = noun.find(':');
+  if ( colon == string::npos || noun.find(':', colon + 1) != string::npos )
+    return true;
+  string name = noun.substr(0, colon);
+  DirectoryAppend(name);
+  IBPtr ip = GetPointer(name);
+  if ( !ip ) return true;
+  const InterfaceBase * ifb = FindInterface(ip, getInterfaceFromNoun(noun));
+  // A set function may change anything, including references.
+  if ( !ifb || ifb->hasSetFunction() ) return true;
+  return !( dynamic_cast<const ParameterBase *>(ifb) ||
+	    dynamic_cast<const ParVectorBase *>(ifb) ||
+	    dynamic_cast<const SwitchBase *>(ifb) );
+}
+
 Repository::GeneratorMap & Repository::generators() {
   static GeneratorMap theMap;;
   return theMap;
@@ -95,9 +150,11 @@ int & Repository::exitOnError() {
 
 void Repository::cleanup() {
   generators().clear();
+  clearRunSnapshots();
 }
 
 void Repository::Register(IBPtr ip) {
+  clearRunSnapshots();
   BaseRepository::Register(ip);
   registerParticle(dynamic_ptr_cast<PDPtr>(ip));
   registerMatcher(dynamic_ptr_cast<PMPtr>(ip));
@@ -105,6 +162,7 @@ void Repository::Register(IBPtr ip) {
 
 void Repository::Register(IBPtr ip, string newName) {
   DirectoryAppend(newName);
+  clearRunSnapshots();
   BaseRepository::Register(ip, newName);
   registerParticle(dynamic_ptr_cast<PDPtr>(ip));
   registerMatcher(dynamic_ptr_cast<PMPtr>(ip));
@@ -112,6 +170,7 @@ void Repository::Register(IBPtr ip, string newName) {
 
 void Repository::registerParticle(tPDPtr pd) {
   if ( !pd ) return;
+  particleNames().clear();
   if ( !member(particles(), pd) ) {
     particles().insert(pd);
     CreateDirectory(pd->fullName());
@@ -125,6 +184,7 @@ void Repository::registerParticle(tPDPtr pd) {
 
 void Repository::registerMatcher(tPMPtr pm) {
   if ( !pm || member(matchers(), pm) ) return;
+  matcherNames().clear();
   pm->addPIfMatchFrom(particles());
   for ( MatcherSet::iterator it = matchers().begin();
 	it != matchers().end(); ++it) {
@@ -140,19 +200,37 @@ tPDPtr Repository::findParticle(string name) {
   DirectoryAppend(path);
   pd = dynamic_ptr_cast<tPDPtr>(GetPointer(path));
   if ( pd ) return pd;
-  for ( ParticleMap::iterator pit = defaultParticles().begin();
-	pit != defaultParticles().end(); ++pit )
+  for ( int itry = 0; itry < 2; ++itry ) {
+    if ( particleNames().empty() ) {
+      // The first particle found with a given name wins, so insert()
+      // rather than overwrite.
+      for ( ParticleMap::iterator pit = defaultParticles().begin();
+	    pit != defaultParticles().end(); ++pit )
+	particleNames().insert(make_pair(pit->second->PDGName(), pit->second));
+      for ( ParticleDataSet::iterator pit = particles().begin();
+	    pit != particles().end(); ++pit )
+	particleNames().insert(make_pair((**pit).PDGName(), *pit));
+    }
+    ParticleNameMap::const_iterator pit = particleNames().find(name);
+    if ( pit == particleNames().end() ) return pd;
     if ( pit->second->PDGName() == name ) return pit->second;
-  for ( ParticleDataSet::iterator pit = particles().begin();
-	pit != particles().end(); ++pit )
-    if ( (**pit).PDGName() == name ) return *pit;
+    // The name has changed since the index was built.
+    particleNames().clear();
+  }
   return pd;
 }
 
 tPMPtr Repository::findMatcher(string name) {
-  for ( MatcherSet::iterator mit = matchers().begin();
-	mit != matchers().end(); ++mit )
-    if ( name == (**mit).name() ) return *mit;
+  for ( int itry = 0; itry < 2; ++itry ) {
+    if ( matcherNames().empty() )
+      for ( MatcherSet::iterator mit = matchers().begin();
+	    mit != matchers().end(); ++mit )
+	matcherNames().insert(make_pair((**mit).name(), *mit));
+    MatcherNameMap::const_iterator mit = matcherNames().find(name);
+    if ( mit == matcherNames().end() ) break;
+    if ( mit->second->name() == name ) return mit->second;
+    matcherNames().clear();
+  }
   return tPMPtr();
 }
 
@@ -185,10 +263,31 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
     clog() << "done\nCloning matchers and particles... " << flush;
 
   MatcherSet localMatchers;
-  ObjectSet localObjects;
   ObjectSet clonedObjects;
   TranslationMap trans;
 
+  // The particle directories requested by the strategy.
+  vector<string> pdirs;
+  if ( eg->strategy() ) {
+    if ( eg->strategy()->localParticlesDir().length() )
+      pdirs.push_back(eg->strategy()->localParticlesDir());
+    pdirs.insert(pdirs.end(), eg->strategy()->defaultParticlesDirs().begin(),
+		 eg->strategy()->defaultParticlesDirs().end());
+  }
+
+  // Unless the repository has been changed since the last time this
+  // generator was isolated, the selection of particles and the
+  // closure of referred objects can be taken from the snapshot.
+  RunSnapshot snap;
+  RunSnapshotMap::iterator sit = runSnapshots().find(eg);
+  bool snapshot = sit != runSnapshots().end() && sit->second.dirs == pdirs;
+  if ( sit != runSnapshots().end() ) {
+    if ( snapshot ) swap(snap, sit->second);
+    runSnapshots().erase(sit);
+  }
+  ObjectSet & localObjects = snap.objects;
+  snap.dirs = pdirs;
+
   for ( MatcherSet::iterator mit = matchers().begin();
 	mit != matchers().end(); ++mit ) {
     PMPtr pm = clone(**mit);
@@ -196,6 +295,7 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
     trans[*mit] = pm;
     localMatchers.insert(pm);
     clonedObjects.insert(pm);
+    if ( snapshot ) continue;
     localObjects.insert(*mit);
     addReferences(*mit, localObjects);
   }
@@ -207,40 +307,36 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
   // not already been selected. Finally add particles from the global
   // default if no default directories has been specified in the
   // strategy which have not already been selected.
-  PDVector allParticles;
+  PDVector & allParticles = snap.particles;
 
-  for ( ParticleMap::const_iterator pit = eg->localParticles().begin();
- 	pit != eg->localParticles().end(); ++pit )
-    allParticles.push_back(pit->second);
-  if ( eg->strategy() ) {
-    tcStrategyPtr strat = eg->strategy();
-    for ( ParticleMap::const_iterator pit = strat->particles().begin();
- 	  pit != strat->particles().end(); ++pit )
+  if ( !snapshot ) {
+    for ( ParticleMap::const_iterator pit = eg->localParticles().begin();
+	  pit != eg->localParticles().end(); ++pit )
       allParticles.push_back(pit->second);
-
-    vector<string> pdirs;
-    if ( eg->strategy()->localParticlesDir().length() )
-      pdirs.push_back(eg->strategy()->localParticlesDir());
-    pdirs.insert(pdirs.end(), eg->strategy()->defaultParticlesDirs().begin(),
-		 eg->strategy()->defaultParticlesDirs().end());
-
-    for ( int i = 0, N = pdirs.size(); i < N; ++i ) {
-      string dir = pdirs[i];
-      for ( ParticleDataSet::iterator pit = particles().begin();
-	    pit != particles().end(); ++pit )
-	if ( (**pit).fullName().substr(0, dir.length()) == dir )
-	  allParticles.push_back(*pit);
+    if ( eg->strategy() ) {
+      tcStrategyPtr strat = eg->strategy();
+      for ( ParticleMap::const_iterator pit = strat->particles().begin();
+	    pit != strat->particles().end(); ++pit )
+	allParticles.push_back(pit->second);
+
+      for ( int i = 0, N = pdirs.size(); i < N; ++i ) {
+	string dir = pdirs[i];
+	for ( ParticleDataSet::iterator pit = particles().begin();
+	      pit != particles().end(); ++pit )
+	  if ( (**pit).fullName().substr(0, dir.length()) == dir )
+	    allParticles.push_back(*pit);
+      }
     }
-  }
 
-  if ( !eg->strategy() || eg->strategy()->defaultParticlesDirs().empty() )
-    for ( ParticleMap::iterator pit = defaultParticles().begin();
-	  pit != defaultParticles().end(); ++pit )
-      allParticles.push_back(pit->second);
+    if ( !eg->strategy() || eg->strategy()->defaultParticlesDirs().empty() )
+      for ( ParticleMap::iterator pit = defaultParticles().begin();
+	    pit != defaultParticles().end(); ++pit )
+	allParticles.push_back(pit->second);
 
-  for ( ParticleDataSet::iterator pit = particles().begin();
-	pit != particles().end(); ++pit )
-    allParticles.push_back(*pit);
+    for ( ParticleDataSet::iterator pit = particles().begin();
+	  pit != particles().end(); ++pit )
+      allParticles.push_back(*pit);
+  }
 
   ParticleMap localParticles;
   set<string> pdgnames;
@@ -253,8 +349,10 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
       trans[*pit] = pd;
       localParticles[pd->id()] = pd;
       clonedObjects.insert(pd);
-      localObjects.insert(*pit);
-      addReferences(*pit, localObjects);
+      if ( !snapshot ) {
+	localObjects.insert(*pit);
+	addReferences(*pit, localObjects);
+      }
       if ( pdgnames.find(pd->PDGName()) != pdgnames.end() )
         std::cerr << "Using duplicate PDGName " << pd->PDGName()
                   << " for a new particle.\n This can cause problems and is not "
@@ -271,8 +369,10 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
     clog() << "done\nCloning other objects... " << flush;
 
   // Clone the OldEventGenerator object to be used:
-  localObjects.insert(eg);
-  addReferences(eg, localObjects);
+  if ( !snapshot ) {
+    localObjects.insert(eg);
+    addReferences(eg, localObjects);
+  }
   EGPtr egrun = clone(*eg);
   clonedObjects.insert(egrun);
   trans[eg] = egrun;
@@ -303,6 +403,11 @@ EGPtr Repository::makeRun(tEGPtr eg, string name) {
     rebind(**it, trans, defaults);
   }
 
+  // Keep the analysed object graph for the next run made from this
+  // generator. If the initialization below registers new objects in
+  // the repository, the snapshot is discarded again.
+  swap(runSnapshots()[eg], snap);
+
   // Now, dependencies may have changed, so we do a final round of
   // updates.
   if ( ThePEG_DEBUG_ITEM(3) )
@@ -330,7 +435,10 @@ PDPtr Repository::defaultParticle(PID id) {
 }
 
 void Repository::defaultParticle(tPDPtr pdp) {
-  if ( pdp ) defaultParticles()[pdp->id()] = pdp;
+  if ( !pdp ) return;
+  defaultParticles()[pdp->id()] = pdp;
+  particleNames().clear();
+  clearRunSnapshots();
 }
 
 struct ParticleOrdering {
@@ -392,6 +500,9 @@ string Repository::load(string filename) {
       >> directories() >> directoryStack() >> globalLibraries() >> readDirs();
   delete is;
   objects().clear();
+  objectCache().clear();
+  clearNameIndices();
+  clearRunSnapshots();
   for ( ObjectSet::iterator it = allObjects().begin();
 	it != allObjects().end(); ++it )
     objects()[(**it).fullName()] = *it;
@@ -473,6 +584,9 @@ modifyEventGenerator(EventGenerator & eg, string filename,
     objects()[name] = *it;
     allObjects().insert(*it);
   }
+  objectCache().clear();
+  clearNameIndices();
+  clearRunSnapshots();
   
   string msg = read(filename, os);
 
@@ -500,6 +614,9 @@ void Repository::resetEventGenerator(EventGenerator & eg) {
     objects()[name] = *it;
     allObjects().insert(*it);
   }
+  objectCache().clear();
+  clearNameIndices();
+  clearRunSnapshots();
   
   for_each(objs, mem_fn(&InterfacedBase::reset));
   eg.initialize(true);
@@ -613,6 +730,9 @@ void Repository::remove(tIBPtr ip) {
   if ( it == objects().end() || ip != it->second ) return;
   objects().erase(it);
   allObjects().erase(ip);
+  objectCache().clear();
+  clearNameIndices();
+  clearRunSnapshots();
   if ( dynamic_ptr_cast<tPDPtr>(ip) ) {
     particles().erase(dynamic_ptr_cast<tPDPtr>(ip));
     defaultParticles().erase(dynamic_ptr_cast<tPDPtr>(ip)->id());
@@ -654,6 +774,8 @@ string Repository::exec(string command, ostream & os) {
       help(command, os);
       return "";
     }
+    if ( !runSnapshots().empty() && isStructural(verb, command) )
+      clearRunSnapshots();
     if ( verb == "rm" ) {
       ObjectSet rmset;
       while ( !command.empty() ) {
@@ -688,6 +810,7 @@ string Repository::exec(string command, ostream & os) {
 	  directoryStack()[i] = '/';
       return "";
     }
+    if ( verb == "mv" ) matcherNames().clear();
     if ( verb == "cp" ) {
       string name = StringUtils::car(command);
       DirectoryAppend(name);
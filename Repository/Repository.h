@@ -49,6 +49,31 @@ public:
   /** A map of EventGenerator objects indexed by their run name. */
   typedef map<string,EGPtr> GeneratorMap;
 
+  /** A hashed map of ParticleData objects indexed by their PDG name. */
+  typedef std::unordered_map<string,tPDPtr> ParticleNameMap;
+
+  /** A hashed map of MatcherBase objects indexed by their name. */
+  typedef std::unordered_map<string,tPMPtr> MatcherNameMap;
+
+  /**
+   * The result of analysing the object graph of an EventGenerator in
+   * the Repository by makeRun(): the particles selected for the run
+   * and the closure of all objects referred to by the generator, its
+   * particles and the matchers.
+   */
+  struct RunSnapshot {
+    /** The particles selected for the run, in order of precedence. */
+    PDVector particles;
+    /** All objects which need to be cloned for the run. */
+    ObjectSet objects;
+    /** The particle directories used by the strategy when the
+     *  snapshot was taken. */
+    vector<string> dirs;
+  };
+
+  /** A map of RunSnapshot objects indexed by their EventGenerator. */
+  typedef map<EGPtr,RunSnapshot> RunSnapshotMap;
+
 public:
 
   /** @name Standsrd constructors and destructors */
@@ -264,6 +289,29 @@ private:
    */
   static void registerMatcher(tPMPtr);
 
+  /**
+   * Clear the hashed name indices used by findParticle() and
+   * findMatcher(). Must be called whenever particles or matchers are
+   * added, removed or renamed.
+   */
+  static void clearNameIndices();
+
+  /**
+   * Discard all RunSnapshot objects cached by makeRun(). Must be
+   * called whenever objects are added, removed or renamed, or
+   * references between them may have changed.
+   */
+  static void clearRunSnapshots();
+
+  /**
+   * Return true if the given command may change the references
+   * between objects in the repository. Setting parameters and
+   * switches is considered safe unless the interface uses a set
+   * function (see InterfaceBase::hasSetFunction()), as is any command
+   * which only inspects the repository.
+   */
+  static bool isStructural(string verb, string command);
+
   /** 
    * Used by read()
    */
@@ -294,6 +342,26 @@ protected:
    */
   static GeneratorMap & generators();
 
+  /**
+   * Particles mapped to their generic PDG name, as searched for by
+   * findParticle(). Particles in defaultParticles() have precedence
+   * over other particles with the same name. Built on demand.
+   */
+  static ParticleNameMap & particleNames();
+
+  /**
+   * Matchers mapped to their name, as searched for by
+   * findMatcher(). Built on demand.
+   */
+  static MatcherNameMap & matcherNames();
+
+  /**
+   * The analysed object graphs of EventGenerators for which makeRun()
+   * has been called since the last structural change of the
+   * repository.
+   */
+  static RunSnapshotMap & runSnapshots();
+
   /**
    * The default file name used by save().
    */
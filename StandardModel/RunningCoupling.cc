@@ -14,6 +14,7 @@
 #include "RunningCoupling.h"
 #include "ThePEG/Interface/ClassDocumentation.h"
 #include "ThePEG/Interface/Parameter.h"
+#include "ThePEG/Interface/Switch.h"
 
 #include "ThePEG/Persistency/PersistentOStream.h"
 #include "ThePEG/Persistency/PersistentIStream.h"
@@ -22,12 +23,75 @@ using namespace ThePEG;
 
 AbstractClassDescription<RunningCoupling> RunningCoupling::initRunningCoupling;
 
+void RunningCoupling::
+values(const vector<Energy2> & scales, vector<double> & vals) const {
+  const StandardModelBase & sm = *(generator()->standardModel());
+  vals.resize(scales.size());
+  for ( int i = 0, N = scales.size(); i < N; ++i )
+    vals[i] = tabulatedValue(scales[i], sm);
+}
+
+void RunningCoupling::tabulate(const StandardModelBase & sm) {
+  theTable.clear();
+  theTableSM = 0;
+  if ( !theTabulate || theTableMaxScale <= theTableMinScale ||
+       theTableMinScale <= ZERO ) return;
+  const double lmin = log(sqr(theTableMinScale)/GeV2);
+  const double lmax = log(sqr(theTableMaxScale)/GeV2);
+  // Double the number of points until linear interpolation is good
+  // enough in the middle of each interval.
+  const int maxPoints = 1 << 20;
+  int N = 64;
+  vector<double> table;
+  while ( true ) {
+    const double dl = (lmax - lmin)/(N - 1);
+    table.resize(N);
+    for ( int i = 0; i < N; ++i )
+      table[i] = value(exp(lmin + i*dl)*GeV2, sm);
+    double maxdev = 0.0;
+    for ( int i = 0; i < N - 1; ++i ) {
+      double exact = value(exp(lmin + (i + 0.5)*dl)*GeV2, sm);
+      double dev = abs(0.5*(table[i] + table[i + 1]) - exact);
+      maxdev = max(maxdev, exact != 0.0? dev/abs(exact): dev);
+    }
+    if ( maxdev <= theTablePrecision ) break;
+    if ( 2*N > maxPoints ) {
+      generator()->logWarning(
+        Exception() << "Could not tabulate the running coupling '"
+	<< name() << "' to the requested precision. The coupling will "
+	<< "be evaluated directly." << Exception::warning);
+      return;
+    }
+    N = 2*N - 1;
+  }
+  theTable.swap(table);
+  theTableLogMin = lmin;
+  theTableInvStep = (N - 1)/(lmax - lmin);
+  theTableSM = &sm;
+}
+
+void RunningCoupling::doinitrun() {
+  Interfaced::doinitrun();
+  theTable.clear();
+  theTableSM = 0;
+}
+
 void RunningCoupling::persistentOutput(PersistentOStream & os) const {
-  os << theScaleFactor;
+  os << theScaleFactor << theTabulate << ounit(theTableMinScale, GeV)
+     << ounit(theTableMaxScale, GeV) << theTablePrecision;
 }
 
-void RunningCoupling::persistentInput(PersistentIStream & is, int) {
+void RunningCoupling::persistentInput(PersistentIStream & is, int version) {
   is >> theScaleFactor;
+  if ( version >= 1 )
+    is >> theTabulate >> iunit(theTableMinScale, GeV)
+       >> iunit(theTableMaxScale, GeV) >> theTablePrecision;
+  else {
+    theTabulate = false;
+    theTableMinScale = 1.0*GeV;
+    theTableMaxScale = 10000.0*GeV;
+    theTablePrecision = 1.0e-6;
+  }
 }
 
 void RunningCoupling::Init() {
@@ -43,5 +107,42 @@ void RunningCoupling::Init() {
 
   interfaceScaleFactor.rank(-1);
 
+  static Switch<RunningCoupling,bool> interfaceTabulate
+    ("Tabulate",
+     "Tabulate the coupling in the logarithm of the scale before the run "
+     "and interpolate in the table rather than evaluating the coupling "
+     "directly.",
+     &RunningCoupling::theTabulate, false, true, false);
+  static SwitchOption interfaceTabulateYes
+    (interfaceTabulate,
+     "Yes",
+     "Use a table.",
+     true);
+  static SwitchOption interfaceTabulateNo
+    (interfaceTabulate,
+     "No",
+     "Evaluate the coupling directly.",
+     false);
+
+  static Parameter<RunningCoupling,Energy> interfaceTableMinScale
+    ("TableMinScale",
+     "The minimum scale in the table. Below this the coupling is "
+     "evaluated directly.",
+     &RunningCoupling::theTableMinScale, GeV, 1.0*GeV, ZERO, ZERO,
+     true, false, Interface::lowerlim);
+
+  static Parameter<RunningCoupling,Energy> interfaceTableMaxScale
+    ("TableMaxScale",
+     "The maximum scale in the table. Above this the coupling is "
+     "evaluated directly.",
+     &RunningCoupling::theTableMaxScale, GeV, 10000.0*GeV, ZERO, ZERO,
+     true, false, Interface::lowerlim);
+
+  static Parameter<RunningCoupling,double> interfaceTablePrecision
+    ("TablePrecision",
+     "The relative precision required for the interpolation in the table.",
+     &RunningCoupling::theTablePrecision, 1.0e-6, 1.0e-12, 0.1,
+     true, false, Interface::limited);
+
 }
 
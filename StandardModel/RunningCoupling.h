@@ -20,6 +20,14 @@ namespace ThePEG {
  * RunningCoupling an abstract base class unifying the treatment
  * of running couplings in ThePEG.
  *
+ * Optionally the coupling may be tabulated in \f$\log Q^2\f$ in a
+ * given range of scales, which is done by the tabulate() function
+ * (eg. by the StandardModelBase object owning the coupling in its
+ * doinitrun() function). The number of points in the table is
+ * doubled until linear interpolation reproduces the exact value
+ * within the requested relative precision in the middle of each
+ * interval. The table is used by tabulatedValue() and value(Energy2).
+ *
  * @see \ref RunningCouplingInterfaces "The interfaces"
  * defined for RunningCoupling.
  * @see StandardModelBase
@@ -31,7 +39,10 @@ public:
   /**
    * The default constructor.
    */
-  RunningCoupling () : theScaleFactor(1.) {}
+  RunningCoupling ()
+    : theScaleFactor(1.), theTabulate(false), theTableMinScale(1.0*GeV),
+      theTableMaxScale(10000.0*GeV), theTablePrecision(1.0e-6),
+      theTableSM(0), theTableLogMin(0.0), theTableInvStep(0.0) {}
 
   /**@name Methods to be implemented by a derived class */
   //@{
@@ -56,9 +67,46 @@ public:
    * StandardModelBase object used by the EventGenerator.
    */
   double value(Energy2 scale) const {
-    return value(scale,*(generator()->standardModel()));
+    return tabulatedValue(scale,*(generator()->standardModel()));
+  }
+
+  /**
+   * Return the value of the coupling at a given \a scale using the
+   * given standard model object, \a sm. If a table has been built
+   * for \a sm and the scale is inside its range, the value is
+   * interpolated from the table, otherwise the virtual value(Energy2,
+   * const StandardModelBase &) function is called.
+   */
+  double tabulatedValue(Energy2 scale, const StandardModelBase & sm) const {
+    if ( &sm == theTableSM && scale > ZERO ) {
+      double l = (log(scale/GeV2) - theTableLogMin)*theTableInvStep;
+      if ( l >= 0.0 && l < theTable.size() - 1 ) {
+	int i = int(l);
+	return theTable[i] + (l - i)*(theTable[i + 1] - theTable[i]);
+      }
+    }
+    return value(scale, sm);
   }
 
+  /**
+   * Fill \a vals with the values of the coupling at the given \a
+   * scales using the StandardModelBase object used by the
+   * EventGenerator.
+   */
+  void values(const vector<Energy2> & scales, vector<double> & vals) const;
+
+  /**
+   * If the tabulation is switched on, build the table using the given
+   * standard model object, \a sm. Should be called after this
+   * object has been initialized for the run.
+   */
+  void tabulate(const StandardModelBase & sm);
+
+  /**
+   * Return true if a table has been built.
+   */
+  bool tabulated() const { return theTableSM != 0; }
+
   /**
    * Return an overestimate to the running coupling at the
    * given scale. This is defined to aid veto algorithms
@@ -108,6 +156,17 @@ public:
    */
   static void Init();
 
+protected:
+
+  /** @name Standard Interfaced functions. */
+  //@{
+  /**
+   * Initialize this object. Called in the run phase just before
+   * a run begins. Removes the table of a previous run.
+   */
+  virtual void doinitrun();
+  //@}
+
 private:
 
   /**
@@ -126,6 +185,48 @@ private:
    */
   double theScaleFactor;
 
+  /**
+   * If true, the coupling is tabulated when tabulate() is called.
+   */
+  bool theTabulate;
+
+  /**
+   * The minimum scale in the table.
+   */
+  Energy theTableMinScale;
+
+  /**
+   * The maximum scale in the table.
+   */
+  Energy theTableMaxScale;
+
+  /**
+   * The requested relative precision of the table.
+   */
+  double theTablePrecision;
+
+  /**
+   * The standard model object for which the table was built. Null if
+   * there is no table.
+   */
+  const StandardModelBase * theTableSM;
+
+  /**
+   * The logarithm of the minimum scale (in units of GeV2) in the table.
+   */
+  double theTableLogMin;
+
+  /**
+   * The inverse of the step in the logarithm of the scale in the table.
+   */
+  double theTableInvStep;
+
+  /**
+   * The values of the coupling for equidistant values of the
+   * logarithm of the scale.
+   */
+  vector<double> theTable;
+
 };
 
 /** @cond TRAITSPECIALIZATIONS */
@@ -144,6 +245,9 @@ template <>
 struct ClassTraits<RunningCoupling>: public ClassTraitsBase<RunningCoupling> {
   /** Return a platform-independent class name */
   static string className() { return "ThePEG::RunningCoupling"; }
+  /** Return the class version. Version 1 added the settings for the
+   *  tabulation of the coupling. */
+  static int version() { return 1; }
 };
 
 /** @endcond */
@@ -125,6 +125,14 @@ void StandardModelBase::doinit() {
   Interfaced::doinit();
 }
 
+void StandardModelBase::doinitrun() {
+  Interfaced::doinitrun();
+  theRunningAlphaEM->initrun();
+  theRunningAlphaS->initrun();
+  theRunningAlphaEM->tabulate(*this);
+  theRunningAlphaS->tabulate(*this);
+}
+
 double StandardModelBase::CKM(unsigned int uFamily,
 			      unsigned int dFamily) const {
   if ( theCKM2Matrix.empty() ) theCKM2Matrix = theCKM->getMatrix(families());
@@ -114,7 +114,7 @@ public:
    * Running \f$\alpha_{EM}\f$.
    */
   double alphaEM(Energy2 scale) const {
-    return theRunningAlphaEM->value(scale, *this);
+    return theRunningAlphaEM->tabulatedValue(scale, *this);
   }
 
   /**
@@ -237,7 +237,7 @@ public:
    * Return the running strong coupling for a given \a scale
    */
   double alphaS(Energy2 scale) const {
-    return theRunningAlphaS->value(scale, *this);
+    return theRunningAlphaS->tabulatedValue(scale, *this);
   }
 
   /**
@@ -320,6 +320,13 @@ protected:
    * @throws InitException if object could not be initialized properly.
    */
   virtual void doinit();
+
+  /**
+   * Initialize this object. Called in the run phase just before a
+   * run begins. Initializes the running couplings and builds their
+   * tables, if requested.
+   */
+  virtual void doinitrun();
   //@}
 
 private:
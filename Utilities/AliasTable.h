@@ -0,0 +1,160 @@
+// -*- C++ -*-
+//
+// AliasTable.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef ThePEG_AliasTable_H
+#define ThePEG_AliasTable_H
+// This is the declaration of the AliasTable class.
+
+#include "ThePEG/Config/ThePEG.h"
+#include <stdexcept>
+
+namespace ThePEG {
+
+/**
+ * AliasTable is a templated class for selecting objects according to
+ * their relative probabilities using Walker's alias method. In
+ * contrast to the Selector class the objects and probabilities are
+ * given all at once in the build() function, after which the table
+ * can not be changed. Given a flat random number between 0 and 1, an
+ * object is then selected in constant time, independent of the
+ * number of objects, and the table is stored in contiguous arrays.
+ *
+ * @see Selector
+ */
+template <typename T>
+class AliasTable {
+
+public:
+
+  /**
+   * Default constructor.
+   */
+  AliasTable() : theSum(0.0) {}
+
+  /**
+   * Build the table from the given \a objects with the corresponding
+   * \a weights. Objects with zero or negative weights will never be
+   * selected.
+   */
+  void build(const vector<T> & objects, const vector<double> & weights) {
+    const int N = objects.size();
+    theObjects = objects;
+    theProbabilities.assign(N, 0.0);
+    theAliases.assign(N, 0);
+    theSum = 0.0;
+    for ( int i = 0; i < N; ++i ) theSum += max(weights[i], 0.0);
+    if ( theSum <= 0.0 ) return;
+    vector<double> q(N);
+    vector<int> small, large;
+    for ( int i = 0; i < N; ++i ) {
+      q[i] = max(weights[i], 0.0)*N/theSum;
+      if ( q[i] < 1.0 ) small.push_back(i);
+      else large.push_back(i);
+    }
+    while ( !small.empty() && !large.empty() ) {
+      int s = small.back();
+      small.pop_back();
+      int l = large.back();
+      theProbabilities[s] = q[s];
+      theAliases[s] = l;
+      q[l] -= 1.0 - q[s];
+      if ( q[l] < 1.0 ) {
+	large.pop_back();
+	small.push_back(l);
+      }
+    }
+    // Whatever is left should have probability one up to rounding.
+    for ( int i = 0, M = large.size(); i < M; ++i ) {
+      theProbabilities[large[i]] = 1.0;
+      theAliases[large[i]] = large[i];
+    }
+    for ( int i = 0, M = small.size(); i < M; ++i ) {
+      theProbabilities[small[i]] = 1.0;
+      theAliases[small[i]] = small[i];
+    }
+  }
+
+  /**
+   * Return the index of an object selected according to its
+   * probability given a flat random number \a rnd between 0 and 1.
+   * @throws range_error if the table is empty.
+   */
+  int index(double rnd) const {
+    if ( empty() )
+      throw range_error("Tried to select an object from an empty AliasTable.");
+    const int N = theObjects.size();
+    double r = rnd*N;
+    int i = min(int(r), N - 1);
+    return r - i < theProbabilities[i]? i: theAliases[i];
+  }
+
+  /**
+   * Select an object according to its probability given a flat
+   * random number \a rnd between 0 and 1.
+   * @throws range_error if the table is empty.
+   */
+  const T & select(double rnd) const { return theObjects[index(rnd)]; }
+
+  /**
+   * Return true if no object can be selected.
+   */
+  bool empty() const { return theSum <= 0.0; }
+
+  /**
+   * Return the number of objects in the table.
+   */
+  int size() const { return theObjects.size(); }
+
+  /**
+   * Return the object with the given index.
+   */
+  const T & operator[](int i) const { return theObjects[i]; }
+
+  /**
+   * Return the sum of the weights of all objects.
+   */
+  double sum() const { return theSum; }
+
+  /**
+   * Remove all objects.
+   */
+  void clear() {
+    theObjects.clear();
+    theProbabilities.clear();
+    theAliases.clear();
+    theSum = 0.0;
+  }
+
+private:
+
+  /**
+   * The objects.
+   */
+  vector<T> theObjects;
+
+  /**
+   * The probability to keep the object in each slot rather than
+   * taking its alias.
+   */
+  vector<double> theProbabilities;
+
+  /**
+   * The alias for each slot.
+   */
+  vector<int> theAliases;
+
+  /**
+   * The sum of all weights.
+   */
+  double theSum;
+
+};
+
+}
+
+#endif /* ThePEG_AliasTable_H */
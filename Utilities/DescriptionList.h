@@ -12,6 +12,7 @@
 
 #include "ThePEG/Config/ThePEG.h"
 #include "ClassDescription.fh"
+#include <unordered_map>
 
 namespace ThePEG {
 
@@ -24,16 +25,17 @@ class DescriptionList {
 public:
 
 #ifndef THEPEG_DYNAMIC_TYPE_INFO_BUG
-  /** Map of class descriptions indexed by type_info objects. */
-  typedef map<const type_info *, ClassDescriptionBase *> DescriptionMap;
+  /** Hashed map of class descriptions indexed by type_info objects. */
+  typedef std::unordered_map<const type_info *, ClassDescriptionBase *>
+  DescriptionMap;
 #else
-  /** Map of class descriptions indexed by type_info objects. */
-  typedef map<string, ClassDescriptionBase *> DescriptionMap;
+  /** Hashed map of class descriptions indexed by type_info objects. */
+  typedef std::unordered_map<string, ClassDescriptionBase *> DescriptionMap;
 #endif
 
-  /** Map of class descriptions indexed by platform-independent class
-   * names. */
-  typedef map<string, ClassDescriptionBase *> StringMap;
+  /** Hashed map of class descriptions indexed by platform-independent
+   * class names. */
+  typedef std::unordered_map<string, ClassDescriptionBase *> StringMap;
 
 public:
 
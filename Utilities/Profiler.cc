@@ -0,0 +1,153 @@
+// -*- C++ -*-
+//
+// Profiler.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the Profiler class.
+//
+
+#include "Profiler.h"
+#include "ThePEG/Interface/InterfacedBase.h"
+#include "ThePEG/Repository/CurrentGenerator.h"
+#include "ThePEG/Repository/EventGenerator.h"
+#include <iomanip>
+
+using namespace ThePEG;
+
+std::atomic<int> Profiler::theNActive(0);
+
+Profiler::Profiler()
+  : theLevel(off), theMaxCalls(0) {}
+
+Profiler::~Profiler() {
+  stop();
+}
+
+Profiler * Profiler::current() {
+  if ( CurrentGenerator::isVoid() ) return 0;
+  Profiler * p = CurrentGenerator::current().profiler();
+  return p && p->level()? p: 0;
+}
+
+string Profiler::categoryName(int c) {
+  switch ( c ) {
+  case stepHandler: return "StepHandler::handle";
+  case matrixElement: return "MEBase::dSigHatDR";
+  case pdf: return "PartonExtractor::fullFn PDFBase::xfl";
+  case decayer: return "Decayer::decay";
+  case analysis: return "AnalysisHandler::analyze";
+  default: return "unknown";
+  }
+}
+
+void Profiler::start(int level, long maxcalls) {
+  std::lock_guard<std::mutex> lock(theMutex);
+  theEntries.clear();
+  theCalls.clear();
+  theThreads.clear();
+  theMaxCalls = level >= trace? maxcalls: 0;
+  theStartTime = Clock::now();
+  if ( !theLevel && level ) ++theNActive;
+  if ( theLevel && !level ) --theNActive;
+  theLevel = level;
+}
+
+void Profiler::stop() {
+  if ( theLevel ) --theNActive;
+  theLevel = off;
+}
+
+void Profiler::record(Category c, const InterfacedBase * obj,
+		      Clock::time_point t0, Clock::time_point t1) {
+  std::lock_guard<std::mutex> lock(theMutex);
+  Entry & e = theEntries[make_pair(int(c), obj)];
+  if ( e.name.empty() ) e.name = categoryName(c) + " " + obj->fullName();
+  double dt = std::chrono::duration<double>(t1 - t0).count();
+  ++e.calls;
+  e.seconds += dt;
+  if ( long(theCalls.size()) >= theMaxCalls ) return;
+  Call call;
+  call.entry = &e;
+  call.category = c;
+  call.start =
+    std::chrono::duration<double,std::micro>(t0 - theStartTime).count();
+  call.duration = dt*1.0e6;
+  int & thread = theThreads[std::this_thread::get_id()];
+  if ( !thread ) thread = theThreads.size();
+  call.thread = thread;
+  theCalls.push_back(call);
+}
+
+namespace {
+
+struct EntryOrdering {
+  bool operator()(const Profiler::Entry * e1,
+		  const Profiler::Entry * e2) const {
+    return e1->seconds > e2->seconds ||
+      ( e1->seconds == e2->seconds && e1->name < e2->name );
+  }
+};
+
+string jsonEscape(string s) {
+  string ret;
+  for ( string::size_type i = 0; i < s.length(); ++i ) {
+    if ( s[i] == '"' || s[i] == '\\' ) ret += '\\';
+    ret += s[i];
+  }
+  return ret;
+}
+
+}
+
+void Profiler::writeSummary(ostream & os) const {
+  vector<const Entry *> sorted;
+  double sum[nCategories] = { 0.0 };
+  for ( map<pair<int,const InterfacedBase *>,Entry>::const_iterator
+	  it = theEntries.begin(); it != theEntries.end(); ++it ) {
+    sorted.push_back(&it->second);
+    sum[it->first.first] += it->second.seconds;
+  }
+  sort(sorted.begin(), sorted.end(), EntryOrdering());
+  double total =
+    std::chrono::duration<double>(Clock::now() - theStartTime).count();
+
+  os << string(78, '=') << endl
+     << "Profiling summary (inclusive wall-clock times, "
+     << total << " s since initialization):" << endl
+     << string(78, '-') << endl
+     << setw(12) << "calls" << setw(14) << "total (s)"
+     << setw(14) << "per call (us)" << "  function and object" << endl
+     << string(78, '-') << endl;
+  for ( int i = 0, N = sorted.size(); i < N; ++i )
+    os << setw(12) << sorted[i]->calls << setw(14) << sorted[i]->seconds
+       << setw(14) << 1.0e6*sorted[i]->seconds/double(sorted[i]->calls)
+       << "  " << sorted[i]->name << endl;
+  os << string(78, '-') << endl;
+  for ( int c = 0; c < nCategories; ++c )
+    if ( sum[c] > 0.0 )
+      os << setw(26) << sum[c] << "  total for " << categoryName(c) << endl;
+  os << string(78, '=') << endl;
+}
+
+bool Profiler::writeTrace(string filename) const {
+  ofstream os(filename.c_str());
+  if ( !os ) return false;
+  os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for ( int i = 0, N = theCalls.size(); i < N; ++i ) {
+    const Call & call = theCalls[i];
+    os << ( i? ",\n": "\n" )
+       << "{\"name\": \"" << jsonEscape(call.entry->name)
+       << "\", \"cat\": \"" << categoryName(call.category)
+       << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << call.thread
+       << ", \"ts\": "
+       << std::fixed << std::setprecision(3) << call.start
+       << ", \"dur\": " << call.duration << "}";
+  }
+  os << "\n]}" << endl;
+  return bool(os);
+}
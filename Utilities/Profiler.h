@@ -0,0 +1,292 @@
+// -*- C++ -*-
+//
+// Profiler.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_Profiler_H
+#define THEPEG_Profiler_H
+//
+// This is the declaration of the Profiler class.
+//
+
+#include "ThePEG/Config/ThePEG.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace ThePEG {
+
+/**
+ * The Profiler class collects the cumulative wall-clock time spent
+ * and the number of calls made to a few central functions in the
+ * event generation, individually for each object involved. These are
+ * StepHandler::handle(), MEBase::dSigHatDR(), the PDFBase::xfl()
+ * evaluations in PartonExtractor::fullFn(), Decayer::decay() and
+ * AnalysisHandler::analyze().
+ *
+ * Each EventGenerator has its own Profiler, which is created in the
+ * initialization of a run if the <code>Profiling</code> switch of the
+ * generator is on, and which writes its summary and trace at the end
+ * of the run. The calls are registered with the Profiler of the
+ * generator currently in charge (see CurrentGenerator), so that
+ * several generators in the same process are profiled separately.
+ * When no profiling is switched on anywhere, the only overhead is the
+ * check of a static atomic counter in the Timer constructor.
+ *
+ * The measurements are made by constructing a Profiler::Timer object
+ * in the scope of the call to be timed. Note that the times are
+ * inclusive, so that e.g. the time spent in the parton densities is
+ * also included in the StepHandler::handle() of a handler which
+ * evaluates them.
+ */
+class Profiler {
+
+public:
+
+  /**
+   * The functions being timed.
+   */
+  enum Category {
+    stepHandler = 0, /**< StepHandler::handle(). */
+    matrixElement,   /**< MEBase::dSigHatDR(). */
+    pdf,             /**< PDFBase::xfl() in PartonExtractor::fullFn(). */
+    decayer,         /**< Decayer::decay(). */
+    analysis,        /**< AnalysisHandler::analyze(). */
+    nCategories      /**< The number of categories. */
+  };
+
+  /**
+   * The amount of information to be collected.
+   */
+  enum Level {
+    off = 0,    /**< No profiling. */
+    report = 1, /**< Cumulative times and number of calls. */
+    trace = 2   /**< Also keep individual calls for a trace file. */
+  };
+
+  /**
+   * The clock used for the measurements.
+   */
+  typedef std::chrono::steady_clock Clock;
+
+  /**
+   * The cumulative information for one function and object.
+   */
+  struct Entry {
+    /** Default constructor. */
+    Entry(): calls(0), seconds(0.0) {}
+    /** The number of calls. */
+    long calls;
+    /** The total time spent. */
+    double seconds;
+    /** The name of the function and object. */
+    string name;
+  };
+
+  /**
+   * Information about an individual call kept for the trace file.
+   */
+  struct Call {
+    /** The function and object called. */
+    const Entry * entry;
+    /** The category of the call. */
+    int category;
+    /** The starting time in microseconds since start(). */
+    double start;
+    /** The duration in microseconds. */
+    double duration;
+    /** The index of the thread in which the call was made, starting
+     *  from 1 in order of appearance. */
+    int thread;
+  };
+
+  /**
+   * Helper class measuring the time spent in its own scope.
+   */
+  class Timer {
+
+  public:
+
+    /**
+     * Start the timing of the function in category \a c for the
+     * given object if the profiling is switched on for the current
+     * generator.
+     */
+    Timer(Category c, tcIBPtr obj): theProfiler(0) {
+      if ( theNActive && ( theProfiler = current() ) ) {
+	theCategory = c;
+	theObject = obj.operator->();
+	theStart = Clock::now();
+      }
+    }
+
+    /**
+     * Register the time spent with the Profiler.
+     */
+    ~Timer() {
+      if ( theProfiler )
+	theProfiler->record(theCategory, theObject, theStart, Clock::now());
+    }
+
+  private:
+
+    /**
+     * The Profiler to register the call with.
+     */
+    Profiler * theProfiler;
+
+    /**
+     * The category.
+     */
+    Category theCategory;
+
+    /**
+     * The object being timed.
+     */
+    const InterfacedBase * theObject;
+
+    /**
+     * The starting time.
+     */
+    Clock::time_point theStart;
+
+  private:
+
+    /**
+     * The copy constructor is private and must never be called.
+     */
+    Timer(const Timer &) = delete;
+
+    /**
+     * The assignment operator is private and must never be called.
+     */
+    Timer & operator=(const Timer &) = delete;
+
+  };
+
+public:
+
+  /**
+   * The default constructor. The profiling is switched off.
+   */
+  Profiler();
+
+  /**
+   * The destructor switches off the profiling.
+   */
+  ~Profiler();
+
+  /**
+   * Clear all collected information and switch on profiling at the
+   * given \a level. At most \a maxcalls individual calls are kept if
+   * the level is trace.
+   */
+  void start(int level, long maxcalls = 100000);
+
+  /**
+   * Switch off profiling. The collected information is kept until
+   * the next call to start().
+   */
+  void stop();
+
+  /**
+   * The current level of profiling.
+   */
+  int level() const { return theLevel; }
+
+  /**
+   * Write a summary of the collected information to the given
+   * stream, ordered in decreasing total time.
+   */
+  void writeSummary(ostream & os) const;
+
+  /**
+   * Write the individual calls collected to the given file in the
+   * Chrome trace event JSON format, which can be viewed in
+   * e.g. chrome://tracing or Perfetto. Returns false if the file
+   * could not be written.
+   */
+  bool writeTrace(string filename) const;
+
+  /**
+   * The name of the given category.
+   */
+  static string categoryName(int c);
+
+  /**
+   * Return the Profiler of the current generator if it is switched
+   * on, otherwise null.
+   */
+  static Profiler * current();
+
+private:
+
+  /**
+   * Register a call of a function in category \a c for the object \a
+   * obj, started at \a t0 and finished at \a t1.
+   */
+  void record(Category c, const InterfacedBase * obj,
+	      Clock::time_point t0, Clock::time_point t1);
+
+  /**
+   * The number of Profiler objects which are currently switched on.
+   */
+  static std::atomic<int> theNActive;
+
+  /**
+   * The current level of profiling.
+   */
+  int theLevel;
+
+  /**
+   * The maximum number of individual calls to keep.
+   */
+  long theMaxCalls;
+
+  /**
+   * The time when start() was called.
+   */
+  Clock::time_point theStartTime;
+
+  /**
+   * The cumulative information indexed by category and object.
+   */
+  map<pair<int,const InterfacedBase *>,Entry> theEntries;
+
+  /**
+   * The individual calls kept for the trace file.
+   */
+  vector<Call> theCalls;
+
+  /**
+   * The indices of the threads in which calls have been made.
+   */
+  map<std::thread::id,int> theThreads;
+
+  /**
+   * Protects the collected information, as calls may be timed in
+   * several threads (see TaskPool).
+   */
+  std::mutex theMutex;
+
+private:
+
+  /**
+   * The copy constructor is private and must never be called.
+   */
+  Profiler(const Profiler &) = delete;
+
+  /**
+   * The assignment operator is private and must never be called.
+   */
+  Profiler & operator=(const Profiler &) = delete;
+
+};
+
+}
+
+#endif /* THEPEG_Profiler_H */
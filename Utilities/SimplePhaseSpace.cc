@@ -60,57 +60,117 @@ Energy SimplePhaseSpace::getMagnitude(Energy2 s, Energy m1, Energy m2)
 
 vector<LorentzMomentum> SimplePhaseSpace::
 CMSn(Energy m0, const vector<Energy> & m)
+{
+  vector<LorentzMomentum> ret;
+  CMSn(ret, m0, m);
+  return ret;
+}
+
+void SimplePhaseSpace::
+CMSn(vector<LorentzMomentum> & ret, Energy m0, const vector<Energy> & m,
+     int batch)
 {
   using Constants::pi;
 
   // Setup constants.
-  int Np = m.size();
-  vector<LorentzMomentum> ret(Np);
+  const int Np = m.size();
+  const int K = max(batch, 1);
+  ret.resize(Np);
   Energy summ = std::accumulate(m.begin(), m.end(), Energy());
   if ( summ >= m0 ) throw ImpossibleKinematics();
 
+  // All candidates are handled in units of the total mass and stored
+  // with the candidate index running fastest, so that the loops over
+  // candidates can be vectorized.
+  vector<double> work(2*Np + 2*Np*K + K);
+  double * mu = &work[0];
+  double * rndv = mu + Np;
+  double * sm = rndv + Np;
+  double * p = sm + Np*K;
+  double * weight = p + Np*K;
+  // Without negative (space-like) masses the magnitudes can be
+  // calculated inline rather than with getMagnitude().
+  bool nonNegativeMasses = true;
+  for ( int i = 0; i < Np; ++i ) {
+    mu[i] = m[i]/m0;
+    if ( m[i] < ZERO ) nonNegativeMasses = false;
+  }
+  const double tmass = 1.0 - summ/m0;
+
+  // The first candidate is usually accepted, so batches of
+  // candidates are only generated if it was rejected.
+  int nk = 1;
   while ( true ) {
-    // First get an ordered list of random numbers.
-    vector<double> rndv(Np);
-    rndv[0] = 1.0;
-    rndv.back() = 0.0;
-    for ( int i = 1; i < Np - 1; ++i ) rndv[i] = UseRandom::rnd();
-    std::sort(rndv.begin() + 1, rndv.end() - 1, std::greater<double>());
+    // First get an ordered list of random numbers for each candidate.
+    for ( int k = 0; k < nk; ++k ) {
+      for ( int i = 1; i < Np - 1; ++i ) rndv[i] = UseRandom::rnd();
+      std::sort(rndv + 1, rndv + Np - 1, std::greater<double>());
+      for ( int i = 1; i < Np - 1; ++i ) sm[i*K + k] = rndv[i];
+    }
 
     // Now setup masses of subsystems.
-    vector<Energy> sm(Np);
-    Energy tmass = m0 - summ;
-    Energy tmp = summ;
-    for ( int i = 0; i < Np; ++i ) {
-      sm[i] = rndv[i]*tmass + tmp;
-      tmp -= m[i];
+    double tmp = summ/m0;
+    for ( int k = 0; k < nk; ++k ) sm[k] = 1.0;
+    for ( int i = 1; i < Np - 1; ++i ) {
+      tmp -= mu[i - 1];
+      double * s = &sm[i*K];
+      for ( int k = 0; k < nk; ++k ) s[k] = s[k]*tmass + tmp;
     }
+    for ( int k = 0; k < nk; ++k ) sm[(Np - 1)*K + k] = mu[Np - 1];
 
     // Now the magnitude of all the momenta can be calculated. This
-    // gives the weight.
-    double weight = 1.0;
-    vector<Energy> p(Np);
-    p[Np - 1] = getMagnitude(sqr(sm[Np - 2]), m[Np -2], sm[Np - 1]);
-    for ( int i = Np - 2; i >= 0; --i )
-      weight *= (p[i] = getMagnitude(sqr(sm[i]), m[i], sm[i + 1]))/sm[i];
-    if ( weight > UseRandom::rnd() ) continue;
+    // gives the weights.
+    for ( int k = 0; k < nk; ++k ) weight[k] = 1.0;
+    for ( int i = Np - 2; i >= 0; --i ) {
+      const double * s0 = &sm[i*K];
+      const double * s1 = &sm[(i + 1)*K];
+      double * pk = &p[i*K];
+      const double mi = mu[i];
+      if ( nonNegativeMasses ) {
+	// Use the same tolerance as getMagnitude(), but only throw after
+	// the loop so that it can still be vectorized.
+	bool impossible = false;
+	for ( int k = 0; k < nk; ++k ) {
+	  const double s = s0[k]*s0[k];
+	  const double aa = s - sqr(mi + s1[k]);
+	  impossible |= aa <= -10.0*s*Constants::epsilon;
+	  pk[k] = 0.5*sqrt(max(aa, 0.0)*(s - sqr(mi - s1[k]))/s);
+	  weight[k] *= pk[k]/s0[k];
+	}
+	if ( impossible ) throw ImpossibleKinematics();
+      } else {
+	for ( int k = 0; k < nk; ++k ) {
+	  pk[k] = getMagnitude(sqr(s0[k]*m0), m[i], s1[k]*m0)/m0;
+	  weight[k] *= pk[k]/s0[k];
+	}
+      }
+    }
+
+    // Take the first accepted candidate.
+    int k = 0;
+    while ( k < nk && weight[k] > UseRandom::rnd() ) ++k;
+    if ( k == nk ) {
+      nk = K;
+      continue;
+    }
 
     // Now we just have to generate the angles.
     ret[Np - 1] = LorentzMomentum(ZERO, ZERO, ZERO, m[Np - 1]);
     for ( int i = Np - 2; i >= 0; --i ) {
-      Momentum3 p3 = polar3Vector(p[i], 2.0*UseRandom::rnd() - 1.0,
+      Energy pa = p[i*K + k]*m0;
+      Momentum3 p3 = polar3Vector(pa, 2.0*UseRandom::rnd() - 1.0,
 				  2.0*pi*UseRandom::rnd());
-      ret[i] = LorentzMomentum(-p3, sqrt(sqr(p[i]) + sqr(m[i])));
+      ret[i] = LorentzMomentum(-p3, sqrt(sqr(pa) + sqr(m[i])));
       if ( i == Np -2 ) {
 	ret[Np - 1] = LorentzMomentum(p3, sqrt(sqr(m[Np - 1]) + p3.mag2()));
       } else {
-	Boost bv = p3*(1.0/sqrt(sqr(p[i]) + sqr(sm[i + 1])));
+	Energy e = sqrt(sqr(pa) + sqr(sm[(i + 1)*K + k]*m0));
+	Boost bv = p3*(1.0/e);
 	if ( bv.mag2() >= 1.0 ) throw ImpossibleKinematics();
-	LorentzRotation r(bv);
-	for ( int j = i + 1; j < Np; ++j ) ret[j]*=r.one();
+	double gamma = e/(sm[(i + 1)*K + k]*m0);
+	for ( int j = i + 1; j < Np; ++j ) ret[j].boost(bv, gamma);
       }
     }
-    return ret;
+    return;
   }
 }
-
@@ -218,6 +218,24 @@ namespace SimplePhaseSpace {
   vector<LorentzMomentum>
   CMSn(Energy m0, const vector<Energy> & m);
 
+  /**
+   * Get a number of randomly distributed momenta. As CMSn(Energy,
+   * const vector<Energy> &) but the momenta are written into a given
+   * vector, which may be reused between calls. The candidate
+   * configurations of the subsystem masses are generated and weighted
+   * \a batch at a time, and the first accepted one is used.
+   * @param ret the vector in which the resulting momenta are placed.
+   * @param m0 the
+   * total invariant mass of the resulting momenta.
+   * @param m a vector
+   * of invariant masses of the resulting momenta.
+   * @param batch the number of candidates generated at a time.
+   * @throw ImpossibleKinematics if the sum of the masses was
+   * larger than the given invariant mass (\f$\sqrt{s}\f$).
+   */
+  void CMSn(vector<LorentzMomentum> & ret, Energy m0,
+	    const vector<Energy> & m, int batch = 4);
+
   /**
    * Set the momentum of a number of particles. Given a number of
    * particles and a total invariant mass m0, distribute their
@@ -233,6 +251,26 @@ namespace SimplePhaseSpace {
   template <typename Container>
   void CMSn(Container & particles, Energy m0);
 
+  /**
+   * Set the momentum of a number of particles according to phase
+   * space reweighted with a given function. This is equivalent to
+   * calling CMSn(Container &, Energy) until <code>weight()</code> is
+   * larger than a flat random number, but the masses and the
+   * temporary momenta are only set up once.
+   * @param particles a container of particles or pointers to
+   * particles. The invariant mass of these particles will not be
+   * chaned.
+   * @param m0 the
+   * total invariant mass of the resulting momenta.
+   * @param weight a function object called without arguments which
+   * returns a weight between zero and one for the current momenta of
+   * the particles.
+   * @throw ImpossibleKinematics if the sum of the masses was
+   * larger than the given invariant mass (\f$\sqrt{s}\f$).
+   */
+  template <typename Container, typename WeightFn>
+  void CMSn(Container & particles, Energy m0, WeightFn weight);
+
 }
 
 }
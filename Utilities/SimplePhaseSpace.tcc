@@ -138,4 +138,32 @@ void SimplePhaseSpace::CMSn(Container & particles, Energy m0)
     Traits::set5Momentum(*i, p[j]);
 }
 
+template <typename Container, typename WeightFn>
+void SimplePhaseSpace::CMSn(Container & particles, Energy m0, WeightFn weight)
+{
+  typedef typename Container::value_type PType;
+  typedef typename Container::iterator Iterator;
+  if ( particles.size() == 2 ) {
+    Iterator it = particles.begin();
+    PType & p1 = *it++;
+    PType & p2 = *it;
+    do {
+      CMS(sqr(m0), p1, p2);
+    } while ( weight() < UseRandom::rnd() );
+    return;
+  }
+  typedef ParticleTraits<PType> Traits;
+  vector<Energy> masses(particles.size());
+  int j = 0;
+  for ( Iterator i = particles.begin();i != particles.end(); ++i, ++j )
+    masses[j] = Traits::mass(*i);
+  vector<LorentzMomentum> p;
+  do {
+    CMSn(p, m0, masses);
+    j = 0;
+    for ( Iterator i = particles.begin();i != particles.end(); ++i, ++j )
+      Traits::set5Momentum(*i, p[j]);
+  } while ( weight() < UseRandom::rnd() );
+}
+
 }
@@ -0,0 +1,104 @@
+// -*- C++ -*-
+//
+// TaskPool.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+//
+// This is the implementation of the non-inlined, non-templated member
+// functions of the TaskPool class.
+//
+
+#include "TaskPool.h"
+
+using namespace ThePEG;
+
+namespace {
+
+/**
+ * True for a thread which is currently performing a task.
+ */
+thread_local bool inTask = false;
+
+}
+
+TaskPool & TaskPool::instance() {
+  static TaskPool pool;
+  return pool;
+}
+
+TaskPool::TaskPool()
+  : theTask(0), theNTasks(0), theNext(0), theRemaining(0),
+    isStopping(false) {}
+
+TaskPool::~TaskPool() {
+  {
+    std::lock_guard<std::mutex> lock(theMutex);
+    isStopping = true;
+  }
+  theWakeUp.notify_all();
+  for ( int i = 0, N = theThreads.size(); i < N; ++i ) theThreads[i].join();
+}
+
+void TaskPool::reserve(int n) {
+  std::lock_guard<std::mutex> runlock(theRunMutex);
+  while ( size() < n ) theThreads.push_back(std::thread(&TaskPool::work, this));
+}
+
+void TaskPool::run(int n, const Task & task) {
+  if ( n <= 0 ) return;
+  if ( theThreads.empty() || n == 1 || inTask ) {
+    for ( int i = 0; i < n; ++i ) task(i);
+    return;
+  }
+
+  std::lock_guard<std::mutex> runlock(theRunMutex);
+  std::unique_lock<std::mutex> lock(theMutex);
+  theTask = &task;
+  theNTasks = n;
+  theNext = 0;
+  theRemaining = n;
+  theException = std::exception_ptr();
+  theWakeUp.notify_all();
+  while ( execute(lock) );
+  while ( theRemaining > 0 ) theFinished.wait(lock);
+  theTask = 0;
+  if ( theException ) {
+    std::exception_ptr e = theException;
+    theException = std::exception_ptr();
+    std::rethrow_exception(e);
+  }
+}
+
+bool TaskPool::execute(std::unique_lock<std::mutex> & lock) {
+  if ( !theTask || theNext >= theNTasks ) return false;
+  int i = theNext++;
+  // The task stays valid until the last one has finished.
+  const Task & task = *theTask;
+  lock.unlock();
+  std::exception_ptr e;
+  inTask = true;
+  try {
+    task(i);
+  }
+  catch ( ... ) {
+    e = std::current_exception();
+  }
+  inTask = false;
+  lock.lock();
+  if ( e && !theException ) theException = e;
+  if ( --theRemaining == 0 ) theFinished.notify_all();
+  return true;
+}
+
+void TaskPool::work() {
+  std::unique_lock<std::mutex> lock(theMutex);
+  while ( true ) {
+    while ( !isStopping && !( theTask && theNext < theNTasks ) )
+      theWakeUp.wait(lock);
+    if ( isStopping ) return;
+    while ( execute(lock) );
+  }
+}
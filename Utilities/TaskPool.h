@@ -0,0 +1,176 @@
+// -*- C++ -*-
+//
+// TaskPool.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_TaskPool_H
+#define THEPEG_TaskPool_H
+//
+// This is the declaration of the TaskPool class.
+//
+
+#include "ThePEG/Config/ThePEG.h"
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace ThePEG {
+
+/**
+ * The TaskPool class keeps a number of worker threads which can be
+ * used to perform independent tasks concurrently within the
+ * generation of one event. There is only one pool, accessed with
+ * instance(), and it has no worker threads unless some object has
+ * asked for them with reserve() (typically in its doinitrun()).
+ *
+ * The run() function performs a given number of tasks using the
+ * worker threads together with the calling thread, and returns when
+ * all of them are finished. Note that most of ThePEG is not
+ * thread-safe (in particular the reference counting of objects), so
+ * the tasks must be carefully restricted to calculations which do not
+ * modify, or copy smart pointers to, objects shared with other tasks.
+ *
+ * @see StdXCombGroup
+ */
+class TaskPool {
+
+public:
+
+  /**
+   * The type of a task. It is called with the index of the task.
+   */
+  typedef std::function<void(int)> Task;
+
+public:
+
+  /**
+   * Return the pool.
+   */
+  static TaskPool & instance();
+
+  /**
+   * The destructor stops and joins all worker threads.
+   */
+  ~TaskPool();
+
+  /**
+   * Make sure there are at least \a n threads available to run()
+   * including the calling one, ie. at least \a n - 1 worker threads.
+   */
+  void reserve(int n);
+
+  /**
+   * The number of threads available to run(), including the calling
+   * thread.
+   */
+  int size() const { return theThreads.size() + 1; }
+
+  /**
+   * Call \a task for each index from 0 to \a n - 1 using the worker
+   * threads and the calling thread, and return when all calls are
+   * finished. If any of the calls threw an exception, the first one
+   * caught is rethrown after all calls are finished. If there are no
+   * worker threads, or if called from within a task, the calls are
+   * made sequentially.
+   */
+  void run(int n, const Task & task);
+
+private:
+
+  /**
+   * The default constructor is private, use instance().
+   */
+  TaskPool();
+
+  /**
+   * The function executed by each worker thread.
+   */
+  void work();
+
+  /**
+   * Perform the next task of the current run(), if any, and return
+   * true. Must be called with \a lock locked on theMutex, which is
+   * released while the task is performed.
+   */
+  bool execute(std::unique_lock<std::mutex> & lock);
+
+private:
+
+  /**
+   * The worker threads.
+   */
+  vector<std::thread> theThreads;
+
+  /**
+   * Serializes calls to run() from different threads.
+   */
+  std::mutex theRunMutex;
+
+  /**
+   * Protects the state of the current run().
+   */
+  std::mutex theMutex;
+
+  /**
+   * Signals the worker threads that there are tasks to perform or
+   * that they should stop.
+   */
+  std::condition_variable theWakeUp;
+
+  /**
+   * Signals the calling thread that all tasks are finished.
+   */
+  std::condition_variable theFinished;
+
+  /**
+   * The task of the current run(), or null if none.
+   */
+  const Task * theTask;
+
+  /**
+   * The number of tasks in the current run().
+   */
+  int theNTasks;
+
+  /**
+   * The index of the next task to be started.
+   */
+  int theNext;
+
+  /**
+   * The number of tasks not yet finished.
+   */
+  int theRemaining;
+
+  /**
+   * The first exception thrown by a task in the current run().
+   */
+  std::exception_ptr theException;
+
+  /**
+   * True if the worker threads should stop.
+   */
+  bool isStopping;
+
+private:
+
+  /**
+   * The copy constructor is private and must never be called.
+   */
+  TaskPool(const TaskPool &) = delete;
+
+  /**
+   * The assignment operator is private and must never be called.
+   */
+  TaskPool & operator=(const TaskPool &) = delete;
+
+};
+
+}
+
+#endif /* THEPEG_TaskPool_H */
@@ -41,3 +41,13 @@ void XSecStat::input(PersistentIStream & is) {
      >> theSumWeights >> theSumWeights2 >> theLastWeight;
 }
 
+void XSecStat::outputVariations(PersistentOStream & os) const {
+  os << theVariationSums << theVariationSums2
+     << theLastVariations << theLastMask;
+}
+
+void XSecStat::inputVariations(PersistentIStream & is) {
+  is >> theVariationSums >> theVariationSums2
+     >> theLastVariations >> theLastMask;
+}
+
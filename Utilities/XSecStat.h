@@ -31,6 +31,12 @@ namespace ThePEG {
  * argument. If the event is then accepted, the accept() function
  * should be called. If an event is later vetoed, the reject()
  * function should be called.
+ *
+ * In addition to the main weight, a vector of variation weights can
+ * be given for each selected event with the variations(const
+ * vector<double> &) function. The weights are identified by their
+ * index in the vector, and the sums for all of them are accumulated
+ * in one go.
  * 
  */
 class XSecStat {
@@ -82,7 +88,11 @@ public:
       theSumWeights [ix] += x.theSumWeights [ix];
       theSumWeights2[ix] += x.theSumWeights2[ix];
     }
+    addTo(theVariationSums, x.theVariationSums);
+    addTo(theVariationSums2, x.theVariationSums2);
     theLastWeight = 0.0;
+    theLastVariations.clear();
+    theLastMask.clear();
     return *this;
   }
 
@@ -93,6 +103,10 @@ public:
     theAttempts = theAccepted = theVetoed = 0;
     theSumWeights = theSumWeights2 = {};
     theLastWeight = 0.0;
+    theVariationSums.clear();
+    theVariationSums2.clear();
+    theLastVariations.clear();
+    theLastMask.clear();
   }
 
   //@}
@@ -121,6 +135,49 @@ public:
     theSumWeights [plainWeights]      +=     weight ;
     theSumWeights2[plainWeights]      += sqr(weight);
     theLastWeight = weight;
+    theLastVariations.clear();
+    theLastMask.clear();
+  }
+
+  /**
+   * Give the variation \a weights of the event last selected with
+   * select(double). Only the weights for which \a mask is true were
+   * produced for the event and are added to the sums. If the event
+   * is later rejected, the weights are removed from the sums again.
+   */
+  void variations(const vector<double> & weights, const vector<bool> & mask) {
+    const size_t n = min(weights.size(), mask.size());
+    if ( theVariationSums.size() < n ) {
+      theVariationSums.resize(n, 0.0);
+      theVariationSums2.resize(n, 0.0);
+    }
+    const double * w = weights.data();
+    double * sw = theVariationSums.data();
+    double * sw2 = theVariationSums2.data();
+    for ( size_t i = 0; i < n; ++i ) {
+      if ( !mask[i] ) continue;
+      sw[i] += w[i];
+      sw2[i] += w[i]*w[i];
+    }
+    theLastVariations.assign(weights.begin(), weights.begin() + n);
+    theLastMask.assign(mask.begin(), mask.begin() + n);
+  }
+
+  /**
+   * Reweight the variation weights of a selected and accepted event
+   * with the given \a factor.
+   */
+  void reweightVariations(double factor) {
+    const size_t n = theLastVariations.size();
+    double * w = theLastVariations.data();
+    double * sw = theVariationSums.data();
+    double * sw2 = theVariationSums2.data();
+    for ( size_t i = 0; i < n; ++i ) {
+      if ( !theLastMask[i] ) continue;
+      sw[i] += (factor - 1.0)*w[i];
+      sw2[i] += (sqr(factor) - 1.0)*w[i]*w[i];
+      w[i] *= factor;
+    }
   }
 
   /**
@@ -145,6 +202,17 @@ public:
     theSumWeights [plainVetoedWeights]      +=     theLastWeight ;
     theSumWeights2[plainVetoedWeights]      += sqr(theLastWeight);
     theVetoed += 1;
+    const size_t n = theLastVariations.size();
+    const double * w = theLastVariations.data();
+    double * sw = theVariationSums.data();
+    double * sw2 = theVariationSums2.data();
+    for ( size_t i = 0; i < n; ++i ) {
+      if ( !theLastMask[i] ) continue;
+      sw[i] -= w[i];
+      sw2[i] -= w[i]*w[i];
+    }
+    theLastVariations.clear();
+    theLastMask.clear();
   }
 
   /**
@@ -229,6 +297,50 @@ public:
       maxXSec()*sqrt(abs(sw2/n-sqr(sw/n))/(n-1));
   }
 
+  /**
+   * The number of variation weights given so far.
+   */
+  size_t nVariations() const { return theVariationSums.size(); }
+
+  /**
+   * The sum of the variation weights with index \a i so far.
+   */
+  double sumVariationWeights(size_t i) const {
+    return i < theVariationSums.size()? theVariationSums[i]: 0.0;
+  }
+
+  /**
+   * The sum of the squared variation weights with index \a i so far.
+   */
+  double sumVariationWeights2(size_t i) const {
+    return i < theVariationSums2.size()? theVariationSums2[i]: 0.0;
+  }
+
+  /**
+   * The current estimate of the cross section for the variation
+   * weight with index \a i.  If no events have been generated,
+   * maxXSec() will be returned.
+   */
+  CrossSection variationXSec(size_t i, double att = 0) const {
+    double n = (att == 0.0 ? attempts() : att);
+    return n ? maxXSec()*sumVariationWeights(i)/n : maxXSec();
+  }
+
+  /**
+   * The current estimate of the error in the cross section for the
+   * variation weight with index \a i. If no events have been
+   * generated, maxXSec() will be returned.
+   */
+  CrossSection variationXSecErr(size_t i, double att = 0) const {
+    double n = (att == 0.0 ? attempts() : att);
+    if ( n < 2 )
+      return maxXSec();
+    double sw = sumVariationWeights(i);
+    double sw2 = sumVariationWeights2(i);
+    return
+      maxXSec()*sqrt(abs(sw2/n-sqr(sw/n))/(n-1));
+  }
+
   /**
    * Number of attempts so far.
    */
@@ -263,8 +375,32 @@ public:
    * Input from a persistent stream.
    */
   void input(PersistentIStream & is);
+
+  /**
+   * Output the sums of the variation weights to a persistent
+   * stream. These are not included in output(), so that the format
+   * of classes which do not use variation weights is unchanged.
+   */
+  void outputVariations(PersistentOStream & os) const;
+
+  /**
+   * Input the sums of the variation weights written with
+   * outputVariations() from a persistent stream.
+   */
+  void inputVariations(PersistentIStream & is);
   //@}
 
+private:
+
+  /**
+   * Add the elements of \a x to the corresponding elements of \a
+   * sum, extending it if needed.
+   */
+  static void addTo(vector<double> & sum, const vector<double> & x) {
+    if ( sum.size() < x.size() ) sum.resize(x.size(), 0.0);
+    for ( size_t i = 0, N = x.size(); i < N; ++i ) sum[i] += x[i];
+  }
+
 private:
 
   /**
@@ -302,6 +438,29 @@ private:
    */
   double theLastWeight;
 
+  /**
+   * The sums of the variation weights so far, excluding vetoed
+   * events.
+   */
+  vector<double> theVariationSums;
+
+  /**
+   * The sums of the squared variation weights so far. For vetoed
+   * events the squares are removed again, unlike for the main weight.
+   */
+  vector<double> theVariationSums2;
+
+  /**
+   * The variation weights of the last selected event.
+   */
+  vector<double> theLastVariations;
+
+  /**
+   * True for the entries in theLastVariations which were produced
+   * for the last selected event.
+   */
+  vector<bool> theLastMask;
+
 };
 
 /** Ouptut an XSecStat to a persistent stream. */
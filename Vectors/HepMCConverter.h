@@ -168,6 +168,12 @@ private:
    */
   void setPdfInfo(const Event & e);
 
+  /**
+   * Return all optional weights of the event \a e, including the
+   * variation weights, indexed by name.
+   */
+  static map<string,double> optionalWeights(const Event & e);
+
 private:
 
   /**
@@ -50,12 +50,20 @@ convert(const Event & ev, GenEvent & gev, bool nocopies,
   HepMCConverter<HepMCEventT,Traits> converter(ev, gev, nocopies, eunit, lunit);
 }
 
+template <typename HepMCEventT, typename Traits>
+map<string,double> HepMCConverter<HepMCEventT,Traits>::
+optionalWeights(const Event & e) {
+  if ( e.weightVector().empty() ) return e.optionalWeights();
+  tcEHPtr eh = dynamic_ptr_cast<tcEHPtr>(e.handler());
+  return eh? eh->optionalWeights(e): e.optionalWeights();
+}
+
 template <typename HepMCEventT, typename Traits>
 HepMCConverter<HepMCEventT,Traits>::
 HepMCConverter(const Event & ev, bool nocopies, Energy eunit, Length lunit)
   : energyUnit(eunit), lengthUnit(lunit) {
 
-  geneve = Traits::newEvent(ev.number(), ev.weight(), ev.optionalWeights());
+  geneve = Traits::newEvent(ev.number(), ev.weight(), optionalWeights(ev));
 
   init(ev, nocopies);
 
@@ -68,7 +76,7 @@ HepMCConverter(const Event & ev, GenEvent & gev, bool nocopies,
   : energyUnit(eunit), lengthUnit(lunit) {
 
   geneve = &gev;
-  Traits::resetEvent(geneve, ev.number(), ev.weight(), ev.optionalWeights());
+  Traits::resetEvent(geneve, ev.number(), ev.weight(), optionalWeights(ev));
 
   init(ev, nocopies);
 
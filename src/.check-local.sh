@@ -12,3 +12,8 @@ rm SimpleLEP.cmp
 time ./runThePEG -d 0 -m SimpleLEP.mod SimpleLEP.run
 ./setupThePEG --exitonerror -r ThePEGDefaults.rpo MultiLEP.in
 time ./runThePEG -d 0 MultiLEP.run
+./testAllocations -r ThePEGDefaults.rpo
+./testKTJetFinder -r ThePEGDefaults.rpo
+./testLWHMerge
+./testSpinDevelopment
+./testVariationWeights -r ThePEGDefaults.rpo
@@ -0,0 +1,337 @@
+// -*- C++ -*-
+//
+// benchKernels.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Micro-benchmarks for some of the core building blocks of ThePEG. A
+// run is isolated from the SimpleLEPGenerator in the given repository
+// file to provide particle data, random numbers and parton densities.
+// Each kernel is timed a number of times and the best time is written
+// out together with the time per call as a JSON array, so that the
+// results can be compared between versions. The conversion to HepMC
+// is only timed if ThePEG was configured with HepMC.
+//
+
+#include "ThePEG/Repository/Repository.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Repository/CurrentGenerator.h"
+#include "ThePEG/Repository/RandomGenerator.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+#include "ThePEG/EventRecord/Particle.h"
+#include "ThePEG/EventRecord/ColourLine.h"
+#include "ThePEG/EventRecord/ColourSinglet.h"
+#include "ThePEG/LesHouches/LesHouchesReader.h"
+#include "ThePEG/PDF/PDFBase.h"
+#include "ThePEG/PDT/EnumParticles.h"
+#include "ThePEG/Utilities/SimplePhaseSpace.h"
+#include "ThePEG/Utilities/Selector.h"
+#include "ThePEG/Utilities/Debug.h"
+#include "ThePEG/Utilities/Exception.h"
+#include "ThePEG/Utilities/DynamicLoader.h"
+#ifdef THEPEG_BENCH_HEPMC
+#include "ThePEG/Config/HepMCHelper.h"
+#include "ThePEG/Vectors/HepMCConverter.h"
+#include "ThePEG/EventRecord/Event.h"
+#endif
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+using namespace ThePEG;
+
+/**
+ * Collect and write out the results of the benchmarks.
+ */
+struct Results {
+
+  /** The factor with which to scale the number of iterations. */
+  double scale;
+
+  /** The number of times each benchmark is repeated. */
+  int nrep;
+
+  /**
+   * The stream where the results are collected. They are only written
+   * out in the end to avoid mixing them with other output.
+   */
+  ostringstream os;
+
+  /** The number of benchmarks written so far. */
+  int nbench;
+
+  /** Constructor. */
+  Results(double s, int n): scale(s), nrep(n), nbench(0) {}
+
+  /** Write out the results as a JSON array. */
+  void write(ostream & out) const {
+    out << "[" << os.str() << "\n]" << endl;
+  }
+
+  /**
+   * Time \a n calls to \a f, which is called with the iteration
+   * number as argument, and write out the best of nrep repetitions.
+   */
+  template <typename F>
+  void run(string name, long n, F f) {
+    n = max(long(n*scale), 1L);
+    double best = -1.0;
+    for ( int irep = 0; irep < nrep; ++irep ) {
+      auto start = std::chrono::steady_clock::now();
+      for ( long i = 0; i < n; ++i ) f(i);
+      auto stop = std::chrono::steady_clock::now();
+      double t = std::chrono::duration<double>(stop - start).count();
+      if ( best < 0.0 || t < best ) best = t;
+    }
+    os << ( nbench++? ",\n": "\n" ) << "{\"benchmark\": \"" << name
+       << "\", \"iterations\": " << n << ", \"repetitions\": " << nrep
+       << ", \"seconds\": " << best << ", \"nsPerCall\": "
+       << 1.0e9*best/double(n) << "}";
+  }
+
+};
+
+/**
+ * Keep the compiler from optimizing away unused results.
+ */
+double sink = 0.0;
+
+/**
+ * Write a Les Houches event file with \a nev e+e- -> u ubar g events.
+ */
+void writeLHEF(string filename, int nev) {
+  std::ofstream os(filename.c_str());
+  os << "<LesHouchesEvents version=\"1.0\">\n<header>\n</header>\n"
+     << "<init>\n"
+     << "  -11 11 45.6 45.6 0 0 0 0 3 1\n"
+     << "  1.0 0.01 1.0 1\n"
+     << "</init>\n";
+  for ( int i = 0; i < nev; ++i ) {
+    double x = 0.1 + 0.8*double(i%97)/97.0;
+    os << "<event>\n"
+       << " 5 1 1.0 91.2 0.0078 0.118\n"
+       << "  -11 -1 0 0 0 0 0.0 0.0 45.6 45.6 0.0 0.0 9.0\n"
+       << "   11 -1 0 0 0 0 0.0 0.0 -45.6 45.6 0.0 0.0 9.0\n"
+       << "    2  1 1 2 501 0 " << 20.0*x << " 10.0 " << 30.0*x
+       << " 40.0 0.0 0.0 9.0\n"
+       << "   -2  1 1 2 0 502 " << -10.0*x << " -5.0 " << -20.0*x
+       << " 30.0 0.0 0.0 9.0\n"
+       << "   21  1 1 2 502 501 " << -10.0*x << " -5.0 " << -10.0*x
+       << " 21.2 0.0 0.0 9.0\n"
+       << "</event>\n";
+  }
+  os << "</LesHouchesEvents>\n";
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  using namespace ThePEG;
+
+  string repo = "ThePEGDefaults.rpo";
+  string generator = "/Defaults/Generators/SimpleLEPGenerator";
+  double scale = 1.0;
+  int nrep = 5;
+
+  for ( int iarg = 1; iarg < argc; ++iarg ) {
+    string arg = argv[iarg];
+    if ( arg == "-r" ) repo = argv[++iarg];
+    else if ( arg == "-g" ) generator = argv[++iarg];
+    else if ( arg == "-s" ) scale = atof(argv[++iarg]);
+    else if ( arg == "-N" ) nrep = atoi(argv[++iarg]);
+    else if ( arg == "-L" ) DynamicLoader::prependPath(argv[++iarg]);
+    else if ( arg.substr(0,2) == "-L" )
+      DynamicLoader::prependPath(arg.substr(2));
+    else {
+      cerr << "Usage: " << argv[0]
+	   << " [-r input-repository-file] [-g generator]"
+	   << " [-s iteration-scale] [-N repetitions] [-L first-load-path]"
+	   << endl;
+      return 3;
+    }
+  }
+
+  try {
+
+    ostringstream msgs;
+    string msg = Repository::load(repo);
+    if ( !msg.empty() ) {
+      cerr << msg << endl;
+      return 1;
+    }
+    msg = Repository::exec("create ThePEG::LesHouchesFileReader "
+			   "/Bench/LHReader LesHouches.so", msgs);
+    if ( !msg.empty() ) {
+      cerr << msg << endl;
+      return 1;
+    }
+    IBPtr lhobj = Repository::GetPointer("/Bench/LHReader");
+    tPDFPtr grv =
+      dynamic_ptr_cast<tPDFPtr>(Repository::GetPointer("/Defaults/Partons/GRV94L"));
+
+    EGPtr eg = Repository::makeRun(Repository::GetObject<EGPtr>(generator),
+				   "benchKernels");
+    // Log output goes to benchKernels.log, keeping stdout for the results.
+    eg->initialize();
+    CurrentGenerator currentGenerator(eg);
+    RanGenPtr rngptr = eg->getObject<RandomGenerator>("/Defaults/Random");
+    UseRandom currentRandom(rngptr);
+    RandomGenerator & rng = *rngptr;
+
+    Results results(scale, nrep);
+
+    // LorentzVector boosts.
+    {
+      vector<LorentzMomentum> ps(1000);
+      for ( int i = 0, N = ps.size(); i < N; ++i )
+	ps[i] = LorentzMomentum(i*MeV, 2.0*i*MeV, -i*MeV, 10.0*i*MeV + 1.0*GeV);
+      Boost b(0.1, -0.2, 0.3);
+      results.run("LorentzVector::boost", 10000000, [&](long i) {
+	  LorentzMomentum & p = ps[i%1000];
+	  p.boost(b);
+	  p.boost(-b);
+	  sink += p.e()/GeV;
+	});
+    }
+
+    // Random numbers.
+    results.run("RandomGenerator::rnd", 10000000, [&](long) {
+	sink += rng.rnd();
+      });
+
+    // Phase space generation.
+    {
+      PVector ps;
+      for ( int i = 0; i < 6; ++i )
+	ps.push_back(eg->getParticle(i%2? ParticleID::piplus:
+				     ParticleID::piminus));
+      results.run("SimplePhaseSpace::CMSn", 100000, [&](long) {
+	  SimplePhaseSpace::CMSn(ps, 100.0*GeV);
+	  sink += ps[0]->momentum().e()/GeV;
+	});
+    }
+
+    // Selecting from a Selector.
+    {
+      Selector<int> sel;
+      for ( int i = 0; i < 100; ++i ) sel.insert(1.0 + i%7, i);
+      results.run("Selector::select", 10000000, [&](long) {
+	  sink += sel.select(rng.rnd());
+	});
+    }
+
+    // Finding colour singlets in a chain of gluons.
+    {
+      PVector chain;
+      chain.push_back(eg->getParticle(ParticleID::u));
+      for ( int i = 0; i < 50; ++i )
+	chain.push_back(eg->getParticle(ParticleID::g));
+      chain.push_back(eg->getParticle(ParticleID::ubar));
+      for ( int i = 1, N = chain.size(); i < N; ++i )
+	ColourLine::create(tPPtr(chain[i - 1]), tPPtr(chain[i]));
+      results.run("ColourSinglet::getSinglets", 10000, [&](long) {
+	  tcParticleSet left(chain.begin(), chain.end());
+	  sink += ColourSinglet::getSinglets(left).size();
+	});
+    }
+
+    // Parton densities.
+    if ( grv ) {
+      grv->init();
+      tcPDPtr proton = eg->getParticleData(ParticleID::pplus);
+      tcPDPtr gluon = eg->getParticleData(ParticleID::g);
+      results.run("GRV94L::xfx", 1000000, [&](long i) {
+	  double x = 1.0e-4 + 0.9*double(i%1000)/1000.0;
+	  Energy2 Q2 = (10.0 + double(i%100))*GeV2;
+	  sink += grv->xfx(proton, gluon, Q2, x);
+	});
+      // All flavours for a batch of 100 points with ten different
+      // scales.
+      cPDVector partons = grv->partons(proton);
+      vector<Energy2> scales(100);
+      vector<double> xs(100);
+      vector<double> xf(100*partons.size());
+      for ( int i = 0; i < 100; ++i ) {
+	scales[i] = (10.0 + double(i/10))*GeV2;
+	xs[i] = 1.0e-4 + 0.9*double(i%10)/10.0;
+      }
+      results.run("GRV94L::xfxBatch", 10000, [&](long) {
+	  grv->xfxBatch(proton, partons, 100, scales.data(), xs.data(),
+			xf.data());
+	  sink += xf[0];
+	});
+    }
+
+    // Reading back persistent objects.
+    {
+      ostringstream os;
+      {
+	PersistentOStream pos(os);
+	pos << eg;
+      }
+      string buffer = os.str();
+      results.run("PersistentIStream::read", 10, [&](long) {
+	  istringstream is(buffer);
+	  PersistentIStream pis(is);
+	  EGPtr copy;
+	  pis >> copy;
+	  sink += copy? 1.0: 0.0;
+	});
+    }
+
+    // Parsing Les Houches event files.
+    {
+      string file = "benchKernels.lhe";
+      writeLHEF(file, 10000);
+      Repository::exec("set /Bench/LHReader:FileName " + file, msgs);
+      // The reader class is in a dynamically loaded library, so only
+      // virtual functions are used here.
+      LesHouchesReader & reader =
+	*static_cast<LesHouchesReader *>(lhobj.operator->());
+      reader.open();
+      results.run("LesHouchesFileReader::readEvent", 100000, [&](long) {
+	  if ( !reader.doReadEvent() ) {
+	    reader.close();
+	    reader.open();
+	    reader.doReadEvent();
+	  }
+	  sink += 1.0;
+	});
+      reader.close();
+      std::remove(file.c_str());
+    }
+
+#ifdef THEPEG_BENCH_HEPMC
+    // Converting full events to HepMC.
+    {
+      EventPtr event = eg->shoot();
+      results.run("HepMCConverter::convert", 1000, [&](long) {
+	  HepMC::GenEvent * hepmc =
+	    HepMCConverter<HepMC::GenEvent>::convert(*event);
+	  sink += 1.0;
+	  delete hepmc;
+	});
+    }
+#endif
+
+    eg->finalize();
+
+    results.write(cout);
+
+  }
+  catch ( std::exception & e ) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+  catch ( ... ) {
+    breakThePEG();
+    cerr << "Unknown Exception\n";
+    return 2;
+  }
+
+  return sink == 0.0? 1: 0;
+}
@@ -0,0 +1,120 @@
+// -*- C++ -*-
+//
+// benchRepositoryRead.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Time Repository::read() on a large input file. If no input file is
+// given, a synthetic one is written which resembles a large setup
+// file: many directories, copied objects, references set via
+// directory-relative names and decay modes given in terms of generic
+// particle names.
+//
+
+#include "ThePEG/Repository/Repository.h"
+#include "ThePEG/Utilities/Debug.h"
+#include "ThePEG/Utilities/Exception.h"
+#include "ThePEG/Utilities/DynamicLoader.h"
+#include <chrono>
+#include <cstdio>
+
+namespace {
+
+void writeInput(std::string filename, int nblocks) {
+  std::ofstream os(filename.c_str());
+  os << "mkdir /Bench\n";
+  for ( int i = 0; i < nblocks; ++i ) {
+    os << "mkdir /Bench/Dir" << i << "\n"
+       << "cd /Bench/Dir" << i << "\n"
+       << "cp /Defaults/AlphaS AlphaS\n"
+       << "cp /Defaults/StandardModel SM\n"
+       << "set AlphaS:LambdaQCD " << 0.1 + 0.1*(i%3) << "\n"
+       << "set SM:QCD/RunningAlphaS AlphaS\n"
+       << "get SM:QCD/RunningAlphaS\n"
+       << "get /Defaults/Particles/Z0:NominalMass\n"
+       << "decaymode Z0->u,ubar; 0.0 1 /Defaults/Decayers/Dummy\n"
+       << "decaymode Z0->d,dbar; 0.0 1 /Defaults/Decayers/Dummy\n"
+       << "decaymode W+->u,dbar; 0.0 1 /Defaults/Decayers/Dummy\n"
+       << "cd /\n";
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  using namespace ThePEG;
+
+  string repo = "ThePEGDefaults.rpo";
+  string file;
+  int nblocks = 20000;
+  int nrep = 1;
+
+  Repository repository;
+
+  for ( int iarg = 1; iarg < argc; ++iarg ) {
+    string arg = argv[iarg];
+    if ( arg == "-r" ) repo = argv[++iarg];
+    else if ( arg == "-n" ) nblocks = atoi(argv[++iarg]);
+    else if ( arg == "-N" ) nrep = atoi(argv[++iarg]);
+    else if ( arg == "-L" ) DynamicLoader::prependPath(argv[++iarg]);
+    else if ( arg.substr(0,2) == "-L" )
+      DynamicLoader::prependPath(arg.substr(2));
+    else if ( arg == "-h" || arg == "--help" ) {
+      cerr << "Usage: " << argv[0]
+	   << " [cmdfile] [-r input-repository-file] [-n synthetic-blocks]"
+	   << " [-N repetitions] [-L first-load-path]" << endl;
+      return 3;
+    }
+    else file = arg;
+  }
+
+  try {
+
+    string msg = repository.load(repo);
+    if ( !msg.empty() ) {
+      cerr << msg << endl;
+      return 1;
+    }
+
+    bool synthetic = file.empty();
+    if ( synthetic ) {
+      file = "benchRepositoryRead.in";
+      writeInput(file, nblocks);
+    }
+
+    ostringstream out;
+    double best = -1.0;
+    for ( int i = 0; i < nrep; ++i ) {
+      if ( i > 0 ) repository.load(repo);
+      auto start = std::chrono::steady_clock::now();
+      msg = repository.read(file, out);
+      auto stop = std::chrono::steady_clock::now();
+      if ( !msg.empty() ) {
+	cerr << msg << endl;
+	return 1;
+      }
+      double t = std::chrono::duration<double>(stop - start).count();
+      if ( best < 0.0 || t < best ) best = t;
+    }
+
+    cout << "{\"benchmark\": \"Repository::read\", \"file\": \"" << file
+	 << "\", \"repetitions\": " << nrep << ", \"seconds\": " << best
+	 << "}" << endl;
+
+    if ( synthetic ) std::remove(file.c_str());
+
+  }
+  catch ( std::exception & e ) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+  catch ( ... ) {
+    breakThePEG();
+    cerr << "Unknown Exception\n";
+    return 2;
+  }
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+// -*- C++ -*-
+//
+// mergeLWH.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Merge histogram files written by LWHFactory with StoreType binary in
+// separate runs. Histograms which were normalized are averaged using
+// the sum of event weights stored for each run, other histograms are
+// added. The result is written out in binary, xml or flat format.
+//
+
+#ifndef LWH
+#define LWH ThePEGLWH
+#endif
+
+#include "ThePEG/Analysis/LWH/AnalysisFactory.h"
+#include <cstdlib>
+#include <memory>
+
+int main(int argc, char * argv[]) {
+  using namespace LWH;
+
+  std::string output = "merged.lwhb";
+  std::string type = "binary";
+  std::vector<std::string> inputs;
+
+  for ( int iarg = 1; iarg < argc; ++iarg ) {
+    std::string arg = argv[iarg];
+    if ( arg == "-o" && iarg + 1 < argc ) output = argv[++iarg];
+    else if ( arg == "-t" && iarg + 1 < argc ) type = argv[++iarg];
+    else if ( arg == "-h" || arg == "--help" || arg[0] == '-' ) {
+      std::cerr << "Usage: " << argv[0]
+		<< " [-o output-file] [-t binary|xml|flat] input-files..."
+		<< std::endl;
+      return 3;
+    }
+    else inputs.push_back(arg);
+  }
+  if ( inputs.empty() ) {
+    std::cerr << argv[0] << ": no input files given." << std::endl;
+    return 3;
+  }
+  if ( type != "binary" && type != "xml" && type != "flat" ) {
+    std::cerr << argv[0] << ": unknown output type '" << type << "'."
+	      << std::endl;
+    return 3;
+  }
+
+  std::vector< std::unique_ptr<Tree> > trees;
+  std::vector<const Tree *> parts;
+  for ( int i = 0, N = inputs.size(); i < N; ++i ) {
+    Tree * t = new Tree(inputs[i], false, true);
+    trees.push_back(std::unique_ptr<Tree>(t));
+    parts.push_back(t);
+    if ( !t->read(inputs[i]) ) {
+      std::cerr << argv[0] << ": could not read histograms from '"
+		<< inputs[i] << "'." << std::endl;
+      return 1;
+    }
+  }
+
+  Tree merged(output, type != "flat", type == "binary");
+  bool ok = merged.merge(parts);
+  if ( !ok )
+    std::cerr << argv[0] << ": some objects with the same name could "
+	      << "not be combined." << std::endl;
+  if ( !merged.commit() ) {
+    std::cerr << argv[0] << ": could not write '" << output << "'."
+	      << std::endl;
+    return 1;
+  }
+  return ok? 0: 2;
+}
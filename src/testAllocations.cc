@@ -0,0 +1,200 @@
+// -*- C++ -*-
+//
+// testAllocations.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Check that the phase space evaluation in StandardEventHandler and
+// StandardXComb does not allocate any memory once the XComb objects
+// have been warmed up. The global operator new is replaced with one
+// counting the number of allocations. Runs are isolated from the
+// SimpleLEPGenerator and from a copy of it set up for gluon pair
+// production in pp collisions (exercising parton densities and soft
+// remnants). For each run a number of events are generated, and after
+// each event the cross section is evaluated repeatedly in the bin of
+// the last event. The first evaluations after an event are allowed
+// to allocate, as the instances of the previous phase space point now
+// belong to the event and some (eg. remnants) are only created when
+// first needed, while the following ones must not.
+//
+
+#include "ThePEG/Repository/Repository.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Repository/CurrentGenerator.h"
+#include "ThePEG/Repository/RandomGenerator.h"
+#include "ThePEG/Handlers/StandardEventHandler.h"
+#include "ThePEG/Handlers/SamplerBase.h"
+#include "ThePEG/EventRecord/Event.h"
+#include "ThePEG/PDF/BeamParticleData.h"
+#include "ThePEG/PDF/PDFBase.h"
+#include "ThePEG/Utilities/Exception.h"
+#include "ThePEG/Utilities/DynamicLoader.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+/**
+ * The number of calls to the global operator new.
+ */
+long nAllocations = 0;
+
+}
+
+void * operator new(std::size_t size) {
+  ++nAllocations;
+  void * p = std::malloc(size? size: 1);
+  if ( !p ) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void * p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+
+using namespace ThePEG;
+
+/**
+ * Isolate a run from the given \a generator, generate \a nev events
+ * and count the allocations in \a ncall calls to
+ * StandardEventHandler::dSigDR() after each, following \a nwarm calls
+ * to warm up. Returns the number of allocations found.
+ */
+long countAllocations(string generator, string run,
+		      int nev, int nwarm, int ncall) {
+  EGPtr eg = Repository::makeRun(Repository::GetObject<EGPtr>(generator),
+				 run);
+  eg->initialize();
+  CurrentGenerator currentGenerator(eg);
+  UseRandom currentRandom(eg->getObject<RandomGenerator>("/Defaults/Random"));
+  tStdEHPtr eh = dynamic_ptr_cast<tStdEHPtr>(eg->eventHandler());
+  if ( !eh ) throw Exception() << "The generator '" << generator
+			       << "' has no StandardEventHandler."
+			       << Exception::runerror;
+
+  long nalloc = 0;
+  CrossSection sum = ZERO;
+  vector<double> r;
+  for ( int iev = 0; iev < nev; ++iev ) {
+    eg->shoot();
+    r.resize(eh->nDim(eh->sampler()->lastBin()));
+    for ( int icall = 0; icall < nwarm; ++icall ) {
+      for ( int i = 0, N = r.size(); i < N; ++i ) r[i] = UseRandom::rnd();
+      sum += eh->dSigDR(r);
+    }
+    long n0 = nAllocations;
+    for ( int icall = 0; icall < ncall; ++icall ) {
+      for ( int i = 0, N = r.size(); i < N; ++i ) r[i] = UseRandom::rnd();
+      sum += eh->dSigDR(r);
+    }
+    nalloc += nAllocations - n0;
+  }
+  eg->finalize();
+
+  cout << run << ": " << nalloc << " allocations in " << nev*ncall
+       << " phase space points (sum of cross sections "
+       << sum/nanobarn << " nb)." << endl;
+  return nalloc;
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  using namespace ThePEG;
+
+  string repo = "ThePEGDefaults.rpo";
+
+  for ( int iarg = 1; iarg < argc; ++iarg ) {
+    string arg = argv[iarg];
+    if ( arg == "-r" ) repo = argv[++iarg];
+    else if ( arg == "-L" ) DynamicLoader::prependPath(argv[++iarg]);
+    else if ( arg.substr(0,2) == "-L" )
+      DynamicLoader::prependPath(arg.substr(2));
+    else {
+      cerr << "Usage: " << argv[0]
+	   << " [-r input-repository-file] [-L first-load-path]" << endl;
+      return 3;
+    }
+  }
+
+  try {
+
+    string msg = Repository::load(repo);
+    if ( !msg.empty() ) {
+      cerr << msg << endl;
+      return 1;
+    }
+
+    // The PDF of the proton is changed below and restored afterwards.
+    tcPDFPtr protonPDF =
+      Repository::GetObject<Ptr<BeamParticleData>::ptr>
+      ("/Defaults/Particles/p+")->pdf();
+
+    ostringstream msgs;
+    const char * setup[] = {
+      "mkdir /TestAllocations",
+      "cd /TestAllocations",
+      "cp /Defaults/Generators/SimpleLEPGenerator PPGenerator",
+      "cp /Defaults/Handlers/SimpleLEPHandler PPHandler",
+      "create ThePEG::FixedCMSLuminosity PPLuminosity FixedCMSLuminosity.so",
+      "set PPLuminosity:Energy 7000",
+      "set PPHandler:LuminosityFunction PPLuminosity",
+      "create ThePEG::MEQQ2GG MEQQ2GG MEQQ2GG.so",
+      "create ThePEG::SubProcessHandler PPSubProcess",
+      "insert PPSubProcess:MatrixElements[0] MEQQ2GG",
+      "set PPSubProcess:PartonExtractor /Defaults/Handlers/StandardExtractor",
+      "erase PPHandler:SubProcessHandlers[0]",
+      "insert PPHandler:SubProcessHandlers[0] PPSubProcess",
+      "set /Defaults/Particles/p+:PDF /Defaults/Partons/GRV94L",
+      "set PPHandler:BeamA /Defaults/Particles/p+",
+      "set PPHandler:BeamB /Defaults/Particles/p+",
+      "create ThePEG::Cuts PPCuts",
+      "set PPCuts:MHatMin 20",
+      "set PPHandler:Cuts PPCuts",
+      "set PPGenerator:EventHandler PPHandler",
+      "set PPGenerator:NumberOfEvents 0"
+    };
+    for ( int i = 0, N = sizeof(setup)/sizeof(setup[0]); i < N; ++i ) {
+      msg = Repository::exec(setup[i], msgs);
+      if ( !msg.empty() ) {
+	cerr << setup[i] << ": " << msg << endl;
+	return 1;
+      }
+    }
+
+    long nalloc =
+      countAllocations("/Defaults/Generators/SimpleLEPGenerator",
+		       "testAllocationsLEP", 20, 100, 500) +
+      countAllocations("/TestAllocations/PPGenerator",
+		       "testAllocationsPP", 20, 100, 500);
+
+    msg = Repository::exec("set /Defaults/Particles/p+:PDF " +
+			   ( protonPDF? protonPDF->fullName(): string("NULL") ),
+			   msgs);
+    if ( !msg.empty() ) {
+      cerr << "restoring /Defaults/Particles/p+:PDF: " << msg << endl;
+      return 1;
+    }
+
+    return nalloc == 0? 0: 1;
+
+  }
+  catch ( std::exception & e ) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+  catch ( ... ) {
+    breakThePEG();
+    cerr << "Unknown Exception\n";
+    return 2;
+  }
+
+}
@@ -0,0 +1,52 @@
+// -*- C++ -*-
+//
+// testCheck.h is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+#ifndef THEPEG_testCheck_H
+#define THEPEG_testCheck_H
+//
+// Helper functions shared by the check programs for counting and
+// reporting failed checks. Each check program is a single
+// translation unit, so the functions are put in an unnamed namespace
+// where the programs may add overloads for their own types.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace {
+
+/**
+ * The number of failed checks.
+ */
+int nFailed = 0;
+
+/**
+ * Check that the condition \a ok is fulfilled, otherwise report a
+ * failure for \a what.
+ */
+void check(std::string what, bool ok) {
+  if ( ok ) return;
+  ++nFailed;
+  std::cerr << what << " failed." << std::endl;
+}
+
+/**
+ * Check that \a a and \a b are equal to a relative precision of
+ * \a eps, otherwise report a failure for \a what.
+ */
+void check(std::string what, double a, double b, double eps = 1.0e-12) {
+  if ( std::abs(a - b) <= eps*std::max(std::abs(a), std::abs(b)) ) return;
+  ++nFailed;
+  std::cerr << what << ": " << a << " != " << b << std::endl;
+}
+
+}
+
+#endif /* THEPEG_testCheck_H */
@@ -0,0 +1,299 @@
+// -*- C++ -*-
+//
+// testKTJetFinder.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Check the jets found by KTJetFinder with the pt recombination
+// scheme against reference jets. A fixed set of massive b quarks and
+// virtual gluons is clustered with the kt, Cambridge/Aachen and
+// anti-kt algorithms. The reference jets were obtained with a direct
+// transcription of the FastJet 3 clustering with the pt_scheme
+// recombiner, where all constituents are made massless before the
+// clustering. If FastJetFinder is available, the jets are also
+// compared to the ones found by FastJet itself.
+//
+
+#include "ThePEG/Repository/Repository.h"
+#include "ThePEG/Cuts/JetFinder.h"
+#include "ThePEG/PDT/ParticleData.h"
+#include "ThePEG/Utilities/DynamicLoader.h"
+#include "testCheck.h"
+#include <sstream>
+
+namespace {
+
+using namespace ThePEG;
+
+/**
+ * Pointer to a constant JetFinder.
+ */
+typedef Ptr<JetFinder>::tcptr tcJetFinderPtr;
+
+/**
+ * Return the particle type of the parton \a name.
+ */
+tcPDPtr particle(string name) {
+  return Repository::GetObject<tcPDPtr>("/Defaults/Particles/" + name);
+}
+
+/**
+ * A parton to be clustered.
+ */
+struct Parton {
+  /** The name of the particle type. */
+  const char * name;
+  /** The momentum components and the mass in GeV. */
+  double px, py, pz, m;
+};
+
+/**
+ * A reference jet.
+ */
+struct Jet {
+  /** The index of the parton giving the type of the jet. */
+  int index;
+  /** The momentum components in GeV. */
+  double px, py, pz, e;
+};
+
+/**
+ * The partons to be clustered.
+ */
+const Parton partons[] = {
+  { "b", 10.9, 18.6, -26.9, 4.17 },
+  { "g", 5.9, 3.9, 0.8, 0.75 },
+  { "g", 6.3, 0.4, 0.1, 0.75 },
+  { "bbar", 27.4, 4.0, -46.5, 4.17 },
+  { "g", 26.7, 5.4, 31.2, 0.75 },
+  { "b", 0.9, 15.7, 6.1, 4.17 },
+  { "g", 0.3, 35.9, -11.3, 0.75 },
+  { "g", 5.1, 2.5, 7.4, 0.75 },
+  { "g", 9.9, 5.3, -15.8, 0.75 },
+  { "bbar", 29.6, 39.7, -55.0, 4.17 }
+};
+
+/**
+ * The reference jets for the anti-kt algorithm with R = 0.4 ordered
+ * in transverse momentum.
+ */
+const Jet antiKtJets[] = {
+  { 0, 40.5512922953, 58.3761727216, -81.8309129164, 108.390420043 },
+  { 3, 37.7580269325, 9.43857436024, -62.1631997117, 73.3417935572 },
+  { 6, 0.3, 35.9, -11.3, 37.6376141646 },
+  { 4, 31.9471615877, 7.94547116527, 38.5718432884, 50.7103415509 },
+  { 5, 0.9, 15.7, 6.1, 16.8674242254 },
+  { 1, 5.9, 3.9, 0.8, 7.11758385971 },
+  { 2, 6.3, 0.4, 0.1, 6.31347764707 }
+};
+
+/**
+ * The reference jets for the kt algorithm with R = 0.7 ordered in
+ * transverse momentum.
+ */
+const Jet ktJets[] = {
+  { 0, 40.5512922953, 58.3761727216, -81.8309129164, 108.390420043 },
+  { 5, 1.20038733879, 51.6130714062, -5.17335452978, 51.8855824563 },
+  { 3, 37.7580269325, 9.43857436024, -62.1631997117, 73.3417935572 },
+  { 4, 31.9471615877, 7.94547116527, 38.5718432884, 50.7103415509 },
+  { 1, 12.6255137602, 4.44512226598, 0.898974052048, 13.415321987 }
+};
+
+/**
+ * The reference jets for the Cambridge/Aachen algorithm with R = 1.0
+ * ordered in transverse momentum.
+ */
+const Jet caJets[] = {
+  { 0, 83.4637953258, 71.6483251088, -142.825191005, 180.274021442 },
+  { 5, 1.20038733879, 51.6130714062, -5.17335452978, 51.8855824563 },
+  { 1, 44.613675105, 12.4025821255, 36.8099743856, 59.1538524868 }
+};
+
+/**
+ * The reference jets for the exclusive kt algorithm with R = 0.7 and
+ * DCut = 100 GeV^2 ordered in transverse momentum.
+ */
+const Jet exclusiveKtJets[] = {
+  { 0, 40.5512922953, 58.3761727216, -81.8309129164, 108.390420043 },
+  { 3, 37.7580269325, 9.43857436024, -62.1631997117, 73.3417935572 },
+  { 6, 0.3, 35.9, -11.3, 37.6376141646 },
+  { 4, 31.9471615877, 7.94547116527, 38.5718432884, 50.7103415509 },
+  { 5, 0.9, 15.7, 6.1, 16.8674242254 },
+  { 1, 12.6255137602, 4.44512226598, 0.898974052048, 13.415321987 }
+};
+
+/**
+ * Cluster the partons with \a finder, and return the types and
+ * momenta of the jets ordered in transverse momentum.
+ */
+void cluster(tcJetFinderPtr finder, tcPDVector & types,
+	     vector<LorentzMomentum> & jets) {
+  types.clear();
+  jets.clear();
+  for ( int i = 0, N = sizeof(partons)/sizeof(Parton); i < N; ++i ) {
+    const Parton & p = partons[i];
+    types.push_back(particle(p.name));
+    jets.push_back(LorentzMomentum(p.px*GeV, p.py*GeV, p.pz*GeV,
+		   sqrt(sqr(p.px) + sqr(p.py) + sqr(p.pz) + sqr(p.m))*GeV));
+  }
+  finder->cluster(types, jets, tcCutsPtr());
+  for ( int i = 0, N = jets.size(); i < N; ++i )
+    for ( int j = i + 1; j < N; ++j )
+      if ( jets[j].perp2() > jets[i].perp2() ) {
+	swap(jets[i], jets[j]);
+	swap(types[i], types[j]);
+      }
+}
+
+/**
+ * Check that the momenta \a a and \a b are equal to a relative
+ * precision of 1e-9, otherwise report a failure for \a what.
+ */
+void check(string what, const LorentzMomentum & a,
+	   const LorentzMomentum & b) {
+  if ( abs(a.x() - b.x()) <= 1.0e-9*a.e() &&
+       abs(a.y() - b.y()) <= 1.0e-9*a.e() &&
+       abs(a.z() - b.z()) <= 1.0e-9*a.e() &&
+       abs(a.e() - b.e()) <= 1.0e-9*a.e() ) return;
+  ++nFailed;
+  cerr << what << ": " << a/GeV << " != " << b/GeV << " GeV" << endl;
+}
+
+/**
+ * Check the jets found by \a finder with the configuration
+ * \a setup against the \a n jets in \a ref. If \a fastjet is given,
+ * also check against the jets found by it with the same
+ * configuration.
+ */
+void checkJets(string what, tcJetFinderPtr finder, tcJetFinderPtr fastjet,
+	       const vector<string> & setup, const Jet * ref, int n) {
+  ostringstream msgs;
+  for ( int i = 0, N = setup.size(); i < N; ++i ) {
+    string cmd = "set " + finder->fullName() + ":" + setup[i];
+    string msg = Repository::exec(cmd, msgs);
+    if ( fastjet )
+      msg += Repository::exec("set " + fastjet->fullName() + ":" + setup[i],
+			      msgs);
+    if ( !msg.empty() ) {
+      check(cmd + ": " + msg, false);
+      return;
+    }
+  }
+
+  tcPDVector types;
+  vector<LorentzMomentum> jets;
+  cluster(finder, types, jets);
+  ostringstream os;
+  os << what << ": number of jets";
+  check(os.str(), int(jets.size()) == n);
+  for ( int i = 0, N = min(int(jets.size()), n); i < N; ++i ) {
+    os.str("");
+    os << what << ": jet " << i;
+    LorentzMomentum p(ref[i].px*GeV, ref[i].py*GeV,
+		      ref[i].pz*GeV, ref[i].e*GeV);
+    check(os.str(), jets[i], p);
+    check(os.str() + " type", types[i] == particle(partons[ref[i].index].name));
+  }
+
+  if ( !fastjet ) return;
+  tcPDVector fjtypes;
+  vector<LorentzMomentum> fjjets;
+  cluster(fastjet, fjtypes, fjjets);
+  check(what + ": number of FastJet jets", fjjets.size() == jets.size());
+  for ( int i = 0, N = min(jets.size(), fjjets.size()); i < N; ++i ) {
+    os.str("");
+    os << what << ": FastJet jet " << i;
+    check(os.str(), jets[i], fjjets[i]);
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  using namespace ThePEG;
+
+  string repo = "ThePEGDefaults.rpo";
+
+  for ( int iarg = 1; iarg < argc; ++iarg ) {
+    string arg = argv[iarg];
+    if ( arg == "-r" ) repo = argv[++iarg];
+    else if ( arg == "-L" ) DynamicLoader::prependPath(argv[++iarg]);
+    else if ( arg.substr(0,2) == "-L" )
+      DynamicLoader::prependPath(arg.substr(2));
+    else {
+      cerr << "Usage: " << argv[0]
+	   << " [-r input-repository-file] [-L first-load-path]" << endl;
+      return 3;
+    }
+  }
+
+  string msg = Repository::load(repo);
+  if ( !msg.empty() ) {
+    cerr << msg << endl;
+    return 1;
+  }
+
+  ostringstream msgs;
+  const char * setup[] = {
+    "mkdir /TestKTJetFinder",
+    "cd /TestKTJetFinder",
+    "create ThePEG::Matcher<StandardQCDParton> Partons",
+    "create ThePEG::KTJetFinder KT KTJetFinder.so",
+    "set KT:UnresolvedMatcher Partons",
+    "set KT:RecombinationScheme Pt"
+  };
+  for ( int i = 0, N = sizeof(setup)/sizeof(setup[0]); i < N; ++i ) {
+    msg = Repository::exec(setup[i], msgs);
+    if ( !msg.empty() ) {
+      cerr << setup[i] << ": " << msg << endl;
+      return 1;
+    }
+  }
+  tcJetFinderPtr kt =
+    Repository::GetObject<tcJetFinderPtr>("/TestKTJetFinder/KT");
+
+  // Compare with FastJet if it is available.
+  tcJetFinderPtr fastjet;
+  if ( Repository::exec("create ThePEG::FastJetFinder FastJet "
+			"FastJetFinder.so", msgs).empty() ) {
+    Repository::exec("set FastJet:UnresolvedMatcher Partons", msgs);
+    Repository::exec("set FastJet:RecombinationScheme Pt", msgs);
+    fastjet =
+      Repository::GetObject<tcJetFinderPtr>("/TestKTJetFinder/FastJet");
+  }
+
+  vector<string> antiKt;
+  antiKt.push_back("Mode Inclusive");
+  antiKt.push_back("Variant AntiKt");
+  antiKt.push_back("ConeRadius 0.4");
+  checkJets("anti-kt", kt, fastjet, antiKt, antiKtJets,
+	    sizeof(antiKtJets)/sizeof(Jet));
+
+  vector<string> ktInclusive;
+  ktInclusive.push_back("Mode Inclusive");
+  ktInclusive.push_back("Variant Kt");
+  ktInclusive.push_back("ConeRadius 0.7");
+  checkJets("kt", kt, fastjet, ktInclusive, ktJets,
+	    sizeof(ktJets)/sizeof(Jet));
+
+  vector<string> ca;
+  ca.push_back("Mode Inclusive");
+  ca.push_back("Variant CA");
+  ca.push_back("ConeRadius 1.0");
+  checkJets("CA", kt, fastjet, ca, caJets, sizeof(caJets)/sizeof(Jet));
+
+  vector<string> ktExclusive;
+  ktExclusive.push_back("Mode Exclusive");
+  ktExclusive.push_back("Variant Kt");
+  ktExclusive.push_back("ConeRadius 0.7");
+  ktExclusive.push_back("DCut 100.0");
+  checkJets("exclusive kt", kt, fastjet, ktExclusive, exclusiveKtJets,
+	    sizeof(exclusiveKtJets)/sizeof(Jet));
+
+  cout << "testKTJetFinder: " << nFailed << " failed checks";
+  if ( !fastjet ) cout << " (FastJetFinder not available)";
+  cout << "." << endl;
+  return nFailed == 0? 0: 1;
+}
@@ -0,0 +1,213 @@
+// -*- C++ -*-
+//
+// testLWHMerge.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Check that LWH trees written in the binary format can be read back
+// and merged. Two runs with different sums of weights each fill a
+// histogram which is then scale()d with the inverse sum of weights, a
+// histogram which is left as it is and two 2D histograms with mixed
+// fixed and variable bin axes. After the round trip through the
+// binary files, the scaled histograms must be merged into the
+// weighted average and the others into the sum. Finally histograms
+// filled from two shards must give the same normalized result as
+// histograms filled directly.
+//
+
+#ifndef LWH
+#define LWH ThePEGLWH
+#endif
+
+#include "ThePEG/Analysis/LWH/AnalysisFactory.h"
+#include "testCheck.h"
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+using namespace LWH;
+
+/**
+ * The bins of the histograms filled in one run before scaling.
+ */
+struct RunBins {
+  /** The bin heights of the scaled histogram before scaling. */
+  std::vector<double> scaled;
+  /** The bin heights of the unscaled histogram. */
+  std::vector<double> plain;
+  /** The bin heights of the 2D histogram with variable y bins. */
+  std::vector<double> mixedxy;
+  /** The bin heights of the 2D histogram with variable x bins. */
+  std::vector<double> mixedyx;
+};
+
+/**
+ * Fill the histograms for run number \a run with \a n events, write
+ * them to the binary file \a file and return the bin heights.
+ */
+RunBins fillRun(int run, int n, std::string file, double & sumw) {
+  Tree tree(file, false, true);
+  HistogramFactory hf(tree);
+  IHistogram1D * scaled = hf.createHistogram1D("/scaled", 10, 0.0, 1.0);
+  IHistogram1D * plain = hf.createHistogram1D("/plain", 10, 0.0, 1.0);
+  std::vector<double> edges;
+  edges.push_back(0.0);
+  edges.push_back(0.1);
+  edges.push_back(0.5);
+  edges.push_back(1.0);
+  Histogram2D * mixedxy = new Histogram2D(4, 0.0, 1.0, edges);
+  Histogram2D * mixedyx = new Histogram2D(edges, 4, 0.0, 1.0);
+  tree.insert("/mixedxy", mixedxy);
+  tree.insert("/mixedyx", mixedyx);
+
+  sumw = 0.0;
+  for ( int i = 0; i < n; ++i ) {
+    double x = std::fmod(0.618034*(i + 1) + 0.1*run, 1.0);
+    double y = std::fmod(0.414214*(i + 1), 1.0);
+    double w = run == 0? 1.0 + i%3: 0.5;
+    sumw += w;
+    scaled->fill(x, w);
+    plain->fill(x, w);
+    mixedxy->fill(x, y, w);
+    mixedyx->fill(x, y, w);
+  }
+
+  RunBins bins;
+  for ( int i = 0; i < 10; ++i ) {
+    bins.scaled.push_back(scaled->binHeight(i));
+    bins.plain.push_back(plain->binHeight(i));
+  }
+  for ( int ix = 0; ix < 4; ++ix )
+    for ( int iy = 0; iy < 3; ++iy ) {
+      bins.mixedxy.push_back(mixedxy->binHeight(ix, iy));
+      bins.mixedyx.push_back(mixedyx->binHeight(iy, ix));
+    }
+  scaled->scale(1.0/sumw);
+  tree.setSumOfWeights(sumw);
+  check("writing " + file, tree.commit());
+  return bins;
+}
+
+/**
+ * Fill 1D and 2D histograms alternating between two shards and the
+ * same histograms without shards, normalize them without explicitly
+ * merging the shards and check that they agree.
+ */
+void checkShards() {
+  Tree tree;
+  HistogramFactory hf(tree);
+  tree.setShards(2);
+  IHistogram1D * sharded = hf.createHistogram1D("/sharded", 10, 0.0, 1.0);
+  IHistogram1D * single = hf.createHistogram1D("/single", 10, 0.0, 1.0);
+  IHistogram2D * sharded2 =
+    hf.createHistogram2D("/sharded2", 4, 0.0, 1.0, 3, 0.0, 1.0);
+  IHistogram2D * single2 =
+    hf.createHistogram2D("/single2", 4, 0.0, 1.0, 3, 0.0, 1.0);
+
+  for ( int i = 0; i < 400; ++i ) {
+    double x = std::fmod(0.618034*(i + 1), 1.0);
+    double y = std::fmod(0.414214*(i + 1), 1.0);
+    double w = 1.0 + i%3;
+    ManagedObject::currentShard() = i%2;
+    sharded->fill(x, w);
+    sharded2->fill(x, y, w);
+    ManagedObject::currentShard() = 0;
+    single->fill(x, w);
+    single2->fill(x, y, w);
+  }
+
+  check("sharded sum of bin heights",
+	sharded->sumBinHeights(), single->sumBinHeights());
+  check("sharded entries", sharded->allEntries() == 400);
+  check("sharded 2D sum of bin heights",
+	sharded2->sumBinHeights(), single2->sumBinHeights());
+  dynamic_cast<Histogram1D *>(sharded)->normalize(1.0);
+  dynamic_cast<Histogram1D *>(single)->normalize(1.0);
+  dynamic_cast<Histogram2D *>(sharded2)->normalize(1.0);
+  dynamic_cast<Histogram2D *>(single2)->normalize(1.0);
+  for ( int i = 0; i < 10; ++i )
+    check("sharded bin", sharded->binHeight(i), single->binHeight(i));
+  for ( int ix = 0; ix < 4; ++ix )
+    for ( int iy = 0; iy < 3; ++iy )
+      check("sharded 2D bin",
+	    sharded2->binHeight(ix, iy), single2->binHeight(ix, iy));
+}
+
+}
+
+int main() {
+  using namespace LWH;
+
+  double sumw0 = 0.0;
+  double sumw1 = 0.0;
+  RunBins run0 = fillRun(0, 300, "testLWHMerge-0.lwhb", sumw0);
+  RunBins run1 = fillRun(1, 500, "testLWHMerge-1.lwhb", sumw1);
+
+  Tree tree0("testLWHMerge-0.lwhb", false, true);
+  Tree tree1("testLWHMerge-1.lwhb", false, true);
+  check("reading testLWHMerge-0.lwhb", tree0.read("testLWHMerge-0.lwhb"));
+  check("reading testLWHMerge-1.lwhb", tree1.read("testLWHMerge-1.lwhb"));
+
+  // The 2D histograms with mixed axes survive the round trip.
+  Histogram2D * xy = dynamic_cast<Histogram2D *>(tree0.find("/mixedxy"));
+  Histogram2D * yx = dynamic_cast<Histogram2D *>(tree0.find("/mixedyx"));
+  check("reading /mixedxy", xy != 0);
+  check("reading /mixedyx", yx != 0);
+  if ( xy && yx ) {
+    check("/mixedxy axes", xy->xAxis().isFixedBinning() &&
+	  !xy->yAxis().isFixedBinning() && xy->yAxis().bins() == 3);
+    check("/mixedyx axes", !yx->xAxis().isFixedBinning() &&
+	  yx->yAxis().isFixedBinning() && yx->xAxis().bins() == 3);
+    for ( int ix = 0; ix < 4; ++ix )
+      for ( int iy = 0; iy < 3; ++iy ) {
+	check("/mixedxy round trip",
+	      xy->binHeight(ix, iy), run0.mixedxy[ix*3 + iy]);
+	check("/mixedyx round trip",
+	      yx->binHeight(iy, ix), run0.mixedyx[ix*3 + iy]);
+      }
+  }
+
+  Tree merged("testLWHMerge.lwhb", false, true);
+  std::vector<const Tree *> parts;
+  parts.push_back(&tree0);
+  parts.push_back(&tree1);
+  check("merging", merged.merge(parts));
+  check("merged sum of weights", merged.sumOfWeights(), sumw0 + sumw1);
+
+  // The scaled histogram is the weighted average of the runs, the
+  // others are summed.
+  IHistogram1D * scaled = dynamic_cast<IHistogram1D *>(merged.find("/scaled"));
+  IHistogram1D * plain = dynamic_cast<IHistogram1D *>(merged.find("/plain"));
+  check("merged /scaled", scaled != 0);
+  check("merged /plain", plain != 0);
+  if ( scaled && plain )
+    for ( int i = 0; i < 10; ++i ) {
+      check("merged /scaled bin", scaled->binHeight(i),
+	    (run0.scaled[i] + run1.scaled[i])/(sumw0 + sumw1));
+      check("merged /plain bin", plain->binHeight(i),
+	    run0.plain[i] + run1.plain[i]);
+    }
+  xy = dynamic_cast<Histogram2D *>(merged.find("/mixedxy"));
+  yx = dynamic_cast<Histogram2D *>(merged.find("/mixedyx"));
+  check("merged /mixedxy", xy != 0);
+  check("merged /mixedyx", yx != 0);
+  if ( xy && yx )
+    for ( int ix = 0; ix < 4; ++ix )
+      for ( int iy = 0; iy < 3; ++iy ) {
+	check("merged /mixedxy bin", xy->binHeight(ix, iy),
+	      run0.mixedxy[ix*3 + iy] + run1.mixedxy[ix*3 + iy]);
+	check("merged /mixedyx bin", yx->binHeight(iy, ix),
+	      run0.mixedyx[ix*3 + iy] + run1.mixedyx[ix*3 + iy]);
+      }
+
+  std::remove("testLWHMerge-0.lwhb");
+  std::remove("testLWHMerge-1.lwhb");
+
+  checkShards();
+
+  std::cout << "testLWHMerge: " << nFailed << " failed checks." << std::endl;
+  return nFailed == 0? 0: 1;
+}
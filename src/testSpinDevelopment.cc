@@ -0,0 +1,197 @@
+// -*- C++ -*-
+//
+// testSpinDevelopment.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Check that the lazy development of spin density matrices in
+// SpinInfo gives the same rho and D matrices as the eager one. The
+// decay chain A -> B C, B -> D E, C -> F G is built and decayed in
+// the order a DecayHandler would, with simple 1 -> 2 vertices with
+// fixed complex amplitudes, once with eager and once with lazy
+// development. In the lazy case the D matrices of B and C must not be
+// calculated until they are used.
+//
+
+#include "ThePEG/EventRecord/SpinInfo.h"
+#include "ThePEG/EventRecord/HelicityVertex.h"
+#include "testCheck.h"
+#include <cmath>
+
+namespace {
+
+using namespace ThePEG;
+
+/**
+ * Check that the matrices \a a and \a b are equal to a precision of
+ * 1e-12, otherwise report a failure for \a what.
+ */
+void check(string what, const RhoDMatrix & a, const RhoDMatrix & b) {
+  bool ok = a.iSpin() == b.iSpin();
+  for ( size_t i = 0; ok && i < size_t(a.iSpin()); ++i )
+    for ( size_t j = 0; j < size_t(a.iSpin()); ++j )
+      if ( std::abs(a(i, j) - b(i, j)) > 1.0e-12 ) ok = false;
+  if ( ok ) return;
+  ++nFailed;
+  cerr << what << ": " << a << " != " << b << endl;
+}
+
+/**
+ * A 1 -> 2 vertex with fixed complex amplitudes for two-state
+ * particles, counting the calculations of D matrices.
+ */
+class TestVertex: public HelicityVertex {
+
+public:
+
+  /**
+   * Construct with amplitudes depending on \a seed.
+   */
+  TestVertex(int seed) {
+    for ( int a = 0; a < 2; ++a )
+      for ( int b = 0; b < 2; ++b )
+	for ( int c = 0; c < 2; ++c ) {
+	  double k = seed + 4*a + 2*b + c + 1;
+	  amp[a][b][c] = Complex(std::sin(1.3*k), std::cos(0.7*k*k));
+	}
+  }
+
+  /**
+   * Return the rho matrix of the outgoing particle at \a loc.
+   */
+  virtual RhoDMatrix getRhoMatrix(int loc, bool) const {
+    const RhoDMatrix & rhoA = incoming()[0]->rhoMatrix();
+    const RhoDMatrix & dOther = outgoing()[1 - loc]->DMatrix();
+    RhoDMatrix rho(PDT::Spin1Half, false);
+    for ( int b = 0; b < 2; ++b ) for ( int bp = 0; bp < 2; ++bp )
+      for ( int a = 0; a < 2; ++a ) for ( int ap = 0; ap < 2; ++ap )
+	for ( int c = 0; c < 2; ++c ) for ( int cp = 0; cp < 2; ++cp )
+	  rho(b, bp) += rhoA(a, ap)*dOther(c, cp)*
+	    ( loc == 0? amp[a][b][c]*std::conj(amp[ap][bp][cp]):
+	      amp[a][c][b]*std::conj(amp[ap][cp][bp]) );
+    rho.normalize();
+    return rho;
+  }
+
+  /**
+   * Return the D matrix of the incoming particle.
+   */
+  virtual RhoDMatrix getDMatrix(int) const {
+    ++nD;
+    const RhoDMatrix & dB = outgoing()[0]->DMatrix();
+    const RhoDMatrix & dC = outgoing()[1]->DMatrix();
+    RhoDMatrix d(PDT::Spin1Half, false);
+    for ( int a = 0; a < 2; ++a ) for ( int ap = 0; ap < 2; ++ap )
+      for ( int b = 0; b < 2; ++b ) for ( int bp = 0; bp < 2; ++bp )
+	for ( int c = 0; c < 2; ++c ) for ( int cp = 0; cp < 2; ++cp )
+	  d(a, ap) += dB(b, bp)*dC(c, cp)*
+	    amp[a][b][c]*std::conj(amp[ap][bp][cp]);
+    d.normalize();
+    return d;
+  }
+
+  /**
+   * The amplitudes.
+   */
+  Complex amp[2][2][2];
+
+  /**
+   * The number of D matrices calculated.
+   */
+  mutable int nD = 0;
+
+};
+
+/**
+ * The matrices obtained in the decay of the chain.
+ */
+struct ChainMatrices {
+  /** The rho matrices of B and C when decayed. */
+  RhoDMatrix rhoB, rhoC;
+  /** The D matrices of A, B and C after the decays. */
+  RhoDMatrix dA, dB, dC;
+  /** The number of D matrices of B and C calculated before A is
+   *  developed. */
+  int nDBeforeA;
+};
+
+/**
+ * Create a SpinInfo for a timelike two-state particle.
+ */
+SpinPtr spin(bool lazy) {
+  SpinPtr s = new_ptr(SpinInfo(PDT::Spin1Half, Lorentz5Momentum(), true));
+  s->lazyDevelopment(lazy);
+  return s;
+}
+
+/**
+ * Let \a parent decay into the stable \a first and \a second in
+ * \a vertex and develop the latter.
+ */
+void develop(tSpinPtr parent, Ptr<TestVertex>::pointer vertex,
+	     tSpinPtr first, tSpinPtr second) {
+  parent->decayVertex(vertex);
+  first->productionVertex(vertex);
+  second->productionVertex(vertex);
+  first->develop();
+  second->develop();
+}
+
+/**
+ * Decay the chain with eager or \a lazy development of the matrices.
+ */
+ChainMatrices decayChain(bool lazy) {
+  SpinPtr a = spin(lazy), b = spin(lazy), c = spin(lazy);
+  SpinPtr d = spin(lazy), e = spin(lazy), f = spin(lazy), g = spin(lazy);
+  Ptr<TestVertex>::pointer va = new_ptr(TestVertex(0));
+  Ptr<TestVertex>::pointer vb = new_ptr(TestVertex(17));
+  Ptr<TestVertex>::pointer vc = new_ptr(TestVertex(42));
+  ChainMatrices ret;
+
+  a->decay();
+  a->decayVertex(va);
+  b->productionVertex(va);
+  c->productionVertex(va);
+
+  b->decay();
+  ret.rhoB = b->rhoMatrix();
+  develop(b, vb, d, e);
+  b->develop();
+
+  c->decay();
+  ret.rhoC = c->rhoMatrix();
+  develop(c, vc, f, g);
+  c->develop();
+
+  ret.nDBeforeA = vb->nD + vc->nD;
+  a->develop();
+  ret.dA = a->DMatrix();
+  ret.dB = b->DMatrix();
+  ret.dC = c->DMatrix();
+  return ret;
+}
+
+}
+
+int main() {
+  using namespace ThePEG;
+
+  ChainMatrices eager = decayChain(false);
+  ChainMatrices lazy = decayChain(true);
+
+  check("rho matrix of B", lazy.rhoB, eager.rhoB);
+  check("rho matrix of C", lazy.rhoC, eager.rhoC);
+  check("D matrix of A", lazy.dA, eager.dA);
+  check("D matrix of B", lazy.dB, eager.dB);
+  check("D matrix of C", lazy.dC, eager.dC);
+
+  // When C is decayed the D matrix of B is needed for its rho matrix,
+  // but the D matrix of C is only needed when A is developed.
+  check("eager development of B and C", eager.nDBeforeA == 2);
+  check("lazy development of B only", lazy.nDBeforeA == 1);
+
+  cout << "testSpinDevelopment: " << nFailed << " failed checks." << endl;
+  return nFailed == 0? 0: 1;
+}
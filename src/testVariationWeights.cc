@@ -0,0 +1,324 @@
+// -*- C++ -*-
+//
+// testVariationWeights.cc is a part of ThePEG - Toolkit for HEP Event Generation
+// Copyright (C) 1999-2019 Leif Lonnblad
+//
+// ThePEG is licenced under version 3 of the GPL, see COPYING for details.
+// Please respect the MCnet academic guidelines, see GUIDELINES for details.
+//
+// Check the handling of variation weights from matrix elements
+// producing different sets of variations. Events are generated from
+// two simple e+e- -> l+l- matrix elements in the same sub-process
+// handler with disjoint names of their variations. Each event must
+// only carry the variations of the matrix element it was generated
+// with, and the cross section of each variation must only include
+// the events it was produced for. Finally the variation weights must
+// survive writing the event to a persistent stream and reading it
+// back, and the names of the variations must survive the same for
+// the generator.
+//
+
+#include "ThePEG/Repository/Repository.h"
+#include "ThePEG/Repository/UseRandom.h"
+#include "ThePEG/Repository/CurrentGenerator.h"
+#include "ThePEG/Repository/RandomGenerator.h"
+#include "ThePEG/Handlers/StandardEventHandler.h"
+#include "ThePEG/MatrixElement/ME2to2Base.h"
+#include "ThePEG/MatrixElement/Tree2toNDiagram.h"
+#include "ThePEG/MatrixElement/ColourLines.h"
+#include "ThePEG/EventRecord/Event.h"
+#include "ThePEG/EventRecord/SubProcess.h"
+#include "ThePEG/PDT/EnumParticles.h"
+#include "ThePEG/Persistency/PersistentOStream.h"
+#include "ThePEG/Persistency/PersistentIStream.h"
+#include "ThePEG/Interface/ClassDocumentation.h"
+#include "ThePEG/Utilities/DescribeClass.h"
+#include "ThePEG/Utilities/Exception.h"
+#include "ThePEG/Utilities/DynamicLoader.h"
+#include "testCheck.h"
+#include <sstream>
+
+namespace ThePEG {
+
+/**
+ * A simple matrix element for e+e- -> l+l-, where l is given by the
+ * template argument, with variation weights given by
+ * optionalWeightNames() and fillOptionalWeights(). The names of the
+ * variations are prefixed by the PDG number of the lepton, so the two
+ * matrix elements used here have disjoint variations.
+ */
+template <long L>
+class TestVariationME: public ME2to2Base {
+
+public:
+
+  /**
+   * The variations produced by this matrix element.
+   */
+  static vector<string> names() {
+    ostringstream os;
+    os << L;
+    vector<string> ret;
+    ret.push_back(os.str() + ":up");
+    ret.push_back(os.str() + ":down");
+    return ret;
+  }
+
+  /**
+   * The weights given for the variations in names().
+   */
+  static double factor(int i) { return i? 0.5 + 0.01*L: 2.0 + 0.01*L; }
+
+  /** @name Virtual functions required by the MEBase class. */
+  //@{
+  virtual unsigned int orderInAlphaS() const { return 0; }
+  virtual unsigned int orderInAlphaEW() const { return 2; }
+  virtual double me2() const {
+    return 32.0*sqr(Constants::pi/137.0)*
+      (sqr(tHat()) + sqr(uHat()))/sqr(sHat());
+  }
+  virtual void getDiagrams() const {
+    tcPDPtr gamma = getParticleData(ParticleID::gamma);
+    tcPDPtr l = getParticleData(L);
+    add(new_ptr((Tree2toNDiagram(2), getParticleData(ParticleID::eminus),
+		 getParticleData(ParticleID::eplus), 1, gamma,
+		 3, l, 3, l->CC(), -1)));
+  }
+  virtual Selector<DiagramIndex> diagrams(const DiagramVector & diags) const {
+    Selector<DiagramIndex> sel;
+    for ( DiagramIndex i = 0; i < diags.size(); ++i ) sel.insert(1.0, i);
+    return sel;
+  }
+  virtual Selector<const ColourLines *>
+  colourGeometries(tcDiagPtr) const {
+    static const ColourLines c("");
+    Selector<const ColourLines *> sel;
+    sel.insert(1.0, &c);
+    return sel;
+  }
+  virtual vector<string> optionalWeightNames() const { return names(); }
+  virtual void fillOptionalWeights(vector<double> & weights) {
+    for ( int i = 0, N = weights.size(); i < N; ++i )
+      weights[i] = factor(i);
+  }
+  //@}
+
+  /**
+   * The standard Init function.
+   */
+  static void Init() {
+    static ClassDocumentation< TestVariationME<L> > documentation
+      ("Test matrix element for variation weights.");
+  }
+
+protected:
+
+  /** @name Clone Methods. */
+  //@{
+  virtual IBPtr clone() const { return new_ptr(*this); }
+  virtual IBPtr fullclone() const { return new_ptr(*this); }
+  //@}
+
+};
+
+/** The matrix element for e+e- -> mu+mu-. */
+typedef TestVariationME<ParticleID::muminus> TestVariationMEMu;
+
+/** The matrix element for e+e- -> nu_mu nu_mubar. */
+typedef TestVariationME<ParticleID::nu_mu> TestVariationMENu;
+
+}
+
+namespace {
+
+using namespace ThePEG;
+
+DescribeNoPIOClass<TestVariationMEMu,ME2to2Base>
+describeTestVariationMEMu("ThePEG::TestVariationMEMu", "");
+
+DescribeNoPIOClass<TestVariationMENu,ME2to2Base>
+describeTestVariationMENu("ThePEG::TestVariationMENu", "");
+
+/**
+ * Check that \a event, generated with the matrix element for the
+ * lepton \a l, has the variations of the matrix element ME for the
+ * lepton \a lme if and only if \a l and \a lme are the same.
+ */
+template <typename ME>
+void checkEvent(const StandardEventHandler & eh, const Event & event,
+		long l, long lme) {
+  map<string,double> weights = eh.optionalWeights(event);
+  vector<string> names = ME::names();
+  for ( int i = 0, N = names.size(); i < N; ++i ) {
+    size_t idx = find(eh.weightNames().begin(), eh.weightNames().end(),
+		      names[i]) - eh.weightNames().begin();
+    bool present = weights.find(names[i]) != weights.end();
+    if ( l == lme ) {
+      check("variation " + names[i] + " present", present);
+      check("variation " + names[i] + " set", event.hasVariationWeight(idx));
+      if ( present )
+	check("variation " + names[i], weights[names[i]], ME::factor(i),
+	      1.0e-10);
+    } else {
+      check("variation " + names[i] + " absent", !present);
+      check("variation " + names[i] + " not set",
+	    !event.hasVariationWeight(idx));
+    }
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  using namespace ThePEG;
+
+  string repo = "ThePEGDefaults.rpo";
+
+  for ( int iarg = 1; iarg < argc; ++iarg ) {
+    string arg = argv[iarg];
+    if ( arg == "-r" ) repo = argv[++iarg];
+    else if ( arg == "-L" ) DynamicLoader::prependPath(argv[++iarg]);
+    else if ( arg.substr(0,2) == "-L" )
+      DynamicLoader::prependPath(arg.substr(2));
+    else {
+      cerr << "Usage: " << argv[0]
+	   << " [-r input-repository-file] [-L first-load-path]" << endl;
+      return 3;
+    }
+  }
+
+  try {
+
+    string msg = Repository::load(repo);
+    if ( !msg.empty() ) {
+      cerr << msg << endl;
+      return 1;
+    }
+
+    ostringstream msgs;
+    const char * setup[] = {
+      "mkdir /TestVariationWeights",
+      "cd /TestVariationWeights",
+      "cp /Defaults/Generators/SimpleLEPGenerator Generator",
+      "cp /Defaults/Handlers/SimpleLEPHandler Handler",
+      "create ThePEG::TestVariationMEMu MEMu",
+      "create ThePEG::TestVariationMENu MENu",
+      "create ThePEG::SubProcessHandler SubProcess",
+      "insert SubProcess:MatrixElements[0] MEMu",
+      "insert SubProcess:MatrixElements[1] MENu",
+      "set SubProcess:PartonExtractor /Defaults/Handlers/EEExtractor",
+      "erase Handler:SubProcessHandlers[0]",
+      "insert Handler:SubProcessHandlers[0] SubProcess",
+      "set Generator:EventHandler Handler",
+      "set Generator:NumberOfEvents 1000"
+    };
+    for ( int i = 0, N = sizeof(setup)/sizeof(setup[0]); i < N; ++i ) {
+      msg = Repository::exec(setup[i], msgs);
+      if ( !msg.empty() ) {
+	cerr << setup[i] << ": " << msg << endl;
+	return 1;
+      }
+    }
+
+    EGPtr eg = Repository::makeRun
+      (Repository::GetObject<EGPtr>("/TestVariationWeights/Generator"),
+       "testVariationWeights");
+    eg->initialize();
+    CurrentGenerator currentGenerator(eg);
+    UseRandom currentRandom(eg->getObject<RandomGenerator>("/Defaults/Random"));
+    tStdEHPtr eh = dynamic_ptr_cast<tStdEHPtr>(eg->eventHandler());
+    if ( !eh ) throw Exception() << "No StandardEventHandler."
+				 << Exception::runerror;
+
+    const long mu = ParticleID::muminus;
+    const long nu = ParticleID::nu_mu;
+    map<string,double> sums;
+    map<long,int> nev;
+    double sumw = 0.0;
+    EventPtr lastEvent;
+    for ( int iev = 0; iev < 1000; ++iev ) {
+      EventPtr event = eg->shoot();
+      long l = abs(event->primarySubProcess()->outgoing()[0]->id());
+      ++nev[l];
+      sumw += event->weight();
+      checkEvent<TestVariationMEMu>(*eh, *event, l, mu);
+      checkEvent<TestVariationMENu>(*eh, *event, l, nu);
+      map<string,double> weights = eh->optionalWeights(*event);
+      for ( map<string,double>::iterator w = weights.begin();
+	    w != weights.end(); ++w ) sums[w->first] += w->second;
+      lastEvent = event;
+    }
+    check("events from both matrix elements", nev[mu] > 0 && nev[nu] > 0);
+
+    // The cross section of each variation only includes the events
+    // it was produced for.
+    check("number of variations", eh->weightNames().size() == 4);
+    for ( size_t i = 0, N = eh->weightNames().size(); i < N; ++i ) {
+      string name = eh->weightNames()[i];
+      check("cross section for " + name,
+	    eh->integratedVariationXSec(i)/nanobarn,
+	    eh->integratedXSec()*sums[name]/sumw/nanobarn, 1.0e-10);
+    }
+
+    // The variation weights survive persistent I/O.
+    ostringstream os;
+    {
+      PersistentOStream pos(os);
+      pos << lastEvent;
+    }
+    istringstream is(os.str());
+    EventPtr readEvent;
+    {
+      PersistentIStream pis(is);
+      pis >> readEvent;
+    }
+    check("reading event", readEvent);
+    if ( readEvent ) {
+      check("persistent weight vector",
+	    readEvent->weightVector() == lastEvent->weightVector());
+      check("persistent weight mask",
+	    readEvent->weightMask() == lastEvent->weightMask());
+    }
+
+    // The names of the variations survive persistent I/O of the
+    // generator, as when a run is resumed from a dump.
+    ostringstream egos;
+    {
+      PersistentOStream pos(egos);
+      pos << eg;
+    }
+    istringstream egis(egos.str());
+    EGPtr readEG;
+    {
+      PersistentIStream pis(egis);
+      pis >> readEG;
+    }
+    tStdEHPtr readEH;
+    if ( readEG ) readEH = dynamic_ptr_cast<tStdEHPtr>(readEG->eventHandler());
+    check("reading generator", readEH);
+    if ( readEH ) {
+      check("persistent variation names",
+	    readEH->weightNames() == eh->weightNames());
+      for ( size_t i = 0, N = eh->weightNames().size(); i < N; ++i )
+	check("persistent index of " + eh->weightNames()[i],
+	      readEH->weightIndex(eh->weightNames()[i]) == i);
+    }
+
+    eg->finalize();
+
+    cout << "testVariationWeights: " << nev[mu] << " mu and " << nev[nu]
+	 << " nu events, " << nFailed << " failed checks." << endl;
+    return nFailed == 0? 0: 1;
+
+  }
+  catch ( std::exception & e ) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+  catch ( ... ) {
+    breakThePEG();
+    cerr << "Unknown Exception\n";
+    return 2;
+  }
+
+}